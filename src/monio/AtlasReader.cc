@@ -8,219 +8,441 @@
 ******************************************************************************/
 #include "AtlasReader.h"
 
+#include <limits>
+#include <string>
+
 #include "oops/util/Logger.h"
 
+#include "Monio.h"
+#include "Remap.h"
 #include "Utils.h"
 #include "UtilsAtlas.h"
-#include "Monio.h"
 
-monio::AtlasReader::AtlasReader(const eckit::mpi::Comm& mpiCommunicator, const int mpiRankOwner):
+monio::AtlasReader::AtlasReader(const eckit::mpi::Comm& mpiCommunicator,
+                                const int mpiRankOwner,
+                                      ThreadPool& threadPool):
     mpiCommunicator_(mpiCommunicator),
-    mpiRankOwner_(mpiRankOwner) {
+    mpiRankOwner_(mpiRankOwner),
+    threadPool_(threadPool) {
   oops::Log::debug() << "AtlasReader::AtlasReader()" << std::endl;
 }
 
-void monio::AtlasReader::populateFieldWithFileData(atlas::Field& field,
-                                             const FileData& fileData,
-                                             const consts::FieldMetadata& fieldMetadata,
-                                             const std::string& readName,
-                                             const bool isLfricConvention) {
-  oops::Log::debug() << "AtlasReader::populateFieldWithFileData()" << std::endl;
-  atlas::Field readField = getReadField(field, fieldMetadata.noFirstLevel);
-  populateFieldWithDataContainer(readField,
-                                 fileData.getData().getContainer(readName),
-                                 fileData.getLfricAtlasMap(),
-                                 fieldMetadata.noFirstLevel,
-                                 isLfricConvention);
+void monio::AtlasReader::setMpiRankOwner(const int mpiRankOwner) {
+  oops::Log::debug() << "AtlasReader::setMpiRankOwner()" << std::endl;
+  mpiRankOwner_ = mpiRankOwner;
 }
 
-void monio::AtlasReader::populateFieldWithDataContainer(atlas::Field& field,
+void monio::AtlasReader::populateFieldWithBlockData(atlas::Field& field,
                                       const std::shared_ptr<DataContainerBase>& dataContainer,
-                                      const std::vector<size_t>& lfricToAtlasMap,
-                                      const bool noFirstLevel,
-                                      const bool isLfricConvention) {
-  oops::Log::debug() << "AtlasReader::populateFieldWithDataContainer()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
-    int dataType = dataContainer.get()->getType();
-    switch (dataType) {
-      case consts::eDataTypes::eDouble: {
-        const std::shared_ptr<DataContainerDouble> dataContainerDouble =
-            std::static_pointer_cast<DataContainerDouble>(dataContainer);
-            populateField(field, dataContainerDouble->getData(), lfricToAtlasMap,
-                          noFirstLevel, isLfricConvention);
-        break;
-      }
-      case consts::eDataTypes::eFloat: {
-        const std::shared_ptr<DataContainerFloat> dataContainerFloat =
-            std::static_pointer_cast<DataContainerFloat>(dataContainer);
-            populateField(field, dataContainerFloat->getData(), lfricToAtlasMap,
-                          noFirstLevel, isLfricConvention);
-        break;
-      }
-      case consts::eDataTypes::eInt: {
-        const std::shared_ptr<DataContainerInt> dataContainerInt =
-            std::static_pointer_cast<DataContainerInt>(dataContainer);
-            populateField(field, dataContainerInt->getData(), lfricToAtlasMap,
-                          noFirstLevel, isLfricConvention);
-        break;
-      }
-      default: {
-        Monio::get().closeFiles();
-        utils::throwException("AtlasReader::populateFieldWithDataContainer()> "
-                                 "Data type not coded for...");
-      }
+                                      const DistributionPlan& distributionPlan) {
+  oops::Log::debug() << "AtlasReader::populateFieldWithBlockData()" << std::endl;
+  int dataType = dataContainer.get()->getType();
+  switch (dataType) {
+    case consts::eDataTypes::eDouble: {
+      const std::shared_ptr<DataContainerDouble> dataContainerDouble =
+          std::static_pointer_cast<DataContainerDouble>(dataContainer);
+      populateLocalField(field, dataContainerDouble->getData(), distributionPlan);
+      break;
+    }
+    case consts::eDataTypes::eFloat: {
+      const std::shared_ptr<DataContainerFloat> dataContainerFloat =
+          std::static_pointer_cast<DataContainerFloat>(dataContainer);
+      populateLocalField(field, dataContainerFloat->getData(), distributionPlan);
+      break;
+    }
+    case consts::eDataTypes::eInt: {
+      const std::shared_ptr<DataContainerInt> dataContainerInt =
+          std::static_pointer_cast<DataContainerInt>(dataContainer);
+      populateLocalField(field, dataContainerInt->getData(), distributionPlan);
+      break;
+    }
+    default: {
+      utils::throwException("AtlasReader::populateFieldWithBlockData()> "
+                            "Data type not coded for...");
+    }
+  }
+}
+
+void monio::AtlasReader::populateFieldsWithOwnerPlan(std::vector<atlas::Field>& fields,
+                        const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                        const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                        const bool isLfricConvention,
+                        const OwnerPlan& ownerPlan) {
+  oops::Log::debug() << "AtlasReader::populateFieldsWithOwnerPlan()" << std::endl;
+  std::vector<std::size_t> levelOffsets(fields.size(), 0);
+  populateFieldsWithOwnerPlan(fields, dataContainers, fieldMetadataVec, levelOffsets,
+                              isLfricConvention, ownerPlan);
+}
+
+void monio::AtlasReader::populateFieldsWithOwnerPlan(std::vector<atlas::Field>& fields,
+                        const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                        const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                        const std::vector<std::size_t>& levelOffsets,
+                        const bool isLfricConvention,
+                        const OwnerPlan& ownerPlan) {
+  oops::Log::debug() << "AtlasReader::populateFieldsWithOwnerPlan()" << std::endl;
+  if (fields.size() != fieldMetadataVec.size() ||
+      (ownerPlan.isMpiRankOwner() == true && levelOffsets.size() != fields.size())) {
+    Monio::get().closeFiles();
+    utils::throwException("AtlasReader::populateFieldsWithOwnerPlan()> "
+                          "Numbers of fields, metadata and offsets do not match...");
+  }
+  std::vector<std::size_t> levelStarts(fields.size());
+  std::vector<std::size_t> numLevels(fields.size());
+  for (std::size_t i = 0; i < fields.size(); ++i) {
+    levelStarts[i] = getReadLevelStart(fields[i], fieldMetadataVec[i], isLfricConvention);
+    if (ownerPlan.isMpiRankOwner() == true) {
+      levelStarts[i] += levelOffsets[i];
     }
+    numLevels[i] = fields[i].shape(consts::eVertical);
   }
+  scatterDataContainers(dataContainers, levelStarts, numLevels, ownerPlan,
+      [&](const std::size_t groupStart, const std::size_t groupEnd,
+          const std::shared_ptr<DataContainerBase>& localData) {
+    std::size_t dataOffset = 0;
+    for (std::size_t i = groupStart; i < groupEnd; ++i) {
+      unpackDataContainer(fields[i], localData, dataOffset, 0, numLevels[i], ownerPlan);
+      dataOffset += ownerPlan.getLocalSize() * numLevels[i];
+    }
+  });
 }
 
-void monio::AtlasReader::populateFieldWithDataContainer(atlas::Field& field,
-                                      const std::shared_ptr<DataContainerBase>& dataContainer) {
-  oops::Log::debug() << "AtlasReader::populateFieldWithDataContainer()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
-    int dataType = dataContainer.get()->getType();
-    switch (dataType) {
+void monio::AtlasReader::scatterDataContainers(
+                        const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                        const std::vector<std::size_t>& levelStarts,
+                        const std::vector<std::size_t>& numLevels,
+                        const OwnerPlan& ownerPlan,
+                  const std::function<void(const std::size_t groupStart,
+                                           const std::size_t groupEnd,
+                          const std::shared_ptr<DataContainerBase>& localData)>& unpackData) {
+  oops::Log::debug() << "AtlasReader::scatterDataContainers()" << std::endl;
+  const bool isOwner = ownerPlan.isMpiRankOwner();
+  if (levelStarts.size() != numLevels.size() ||
+      (isOwner == true && dataContainers.size() != numLevels.size())) {
+    Monio::get().closeFiles();
+    utils::throwException("AtlasReader::scatterDataContainers()> "
+                          "Numbers of fields and read data do not match...");
+  }
+  // Data are exchanged in their file's type, which is known on the owner PE only. Fields are
+  // divided into groups of one type that fit within the limit of an MPI count on the owner PE.
+  std::vector<int> dataTypes;
+  if (isOwner == true) {
+    for (const auto& dataContainer : dataContainers) {
+      dataTypes.push_back(dataContainer->getType());
+    }
+  }
+  ownerPlan.broadcast(dataTypes);
+  const std::size_t maxValues = std::numeric_limits<int>::max();
+  const std::size_t globalSize = ownerPlan.getGlobalSize();
+  std::size_t groupStart = 0;
+  while (groupStart < numLevels.size()) {
+    std::size_t groupEnd = groupStart;
+    std::size_t valuesPerPoint = 0;
+    while (groupEnd < numLevels.size()) {
+      if (groupEnd != groupStart &&
+          (dataTypes[groupEnd] != dataTypes[groupStart] ||
+           (valuesPerPoint + numLevels[groupEnd]) * globalSize > maxValues)) {
+        break;
+      }
+      valuesPerPoint += numLevels[groupEnd];
+      ++groupEnd;
+    }
+    if (valuesPerPoint * globalSize > maxValues) {
+      Monio::get().closeFiles();
+      utils::throwException("AtlasReader::scatterDataContainers()> Field " +
+                            std::to_string(groupStart) + " exceeds the limit of an MPI count...");
+    }
+    std::shared_ptr<DataContainerBase> localData;
+    switch (dataTypes[groupStart]) {
       case consts::eDataTypes::eDouble: {
-        const std::shared_ptr<DataContainerDouble> dataContainerDouble =
-            std::static_pointer_cast<DataContainerDouble>(dataContainer);
-            populateField(field, dataContainerDouble->getData());
+        std::shared_ptr<DataContainerDouble> localDataDouble =
+            std::make_shared<DataContainerDouble>("");
+        scatterFileData<DataContainerDouble>(dataContainers, levelStarts, numLevels, groupStart,
+                                             groupEnd, valuesPerPoint, ownerPlan,
+                                             localDataDouble->getData());
+        localData = localDataDouble;
         break;
       }
       case consts::eDataTypes::eFloat: {
-        const std::shared_ptr<DataContainerFloat> dataContainerFloat =
-            std::static_pointer_cast<DataContainerFloat>(dataContainer);
-            populateField(field, dataContainerFloat->getData());
+        std::shared_ptr<DataContainerFloat> localDataFloat =
+            std::make_shared<DataContainerFloat>("");
+        scatterFileData<DataContainerFloat>(dataContainers, levelStarts, numLevels, groupStart,
+                                            groupEnd, valuesPerPoint, ownerPlan,
+                                            localDataFloat->getData());
+        localData = localDataFloat;
         break;
       }
       case consts::eDataTypes::eInt: {
-        const std::shared_ptr<DataContainerInt> dataContainerInt =
-            std::static_pointer_cast<DataContainerInt>(dataContainer);
-            populateField(field, dataContainerInt->getData());
+        std::shared_ptr<DataContainerInt> localDataInt =
+            std::make_shared<DataContainerInt>("");
+        scatterFileData<DataContainerInt>(dataContainers, levelStarts, numLevels, groupStart,
+                                          groupEnd, valuesPerPoint, ownerPlan,
+                                          localDataInt->getData());
+        localData = localDataInt;
         break;
       }
       default: {
         Monio::get().closeFiles();
-        utils::throwException("AtlasReader::populateFieldWithDataContainer()> "
-                                 "Data type not coded for...");
+        utils::throwException("AtlasReader::scatterDataContainers()> Data type not coded for...");
       }
     }
+    unpackData(groupStart, groupEnd, localData);
+    groupStart = groupEnd;
   }
 }
 
-template<typename T>
-void monio::AtlasReader::populateField(atlas::Field& field,
-                                 const std::vector<T>& dataVec,
-                                 const std::vector<size_t>& lfricToAtlasMap,
-                                 const bool noFirstLevel,
-                                 const bool isLfricConvention) {
-  oops::Log::debug() << "AtlasReader::populateField()" << std::endl;
-  auto fieldView = atlas::array::make_view<T, 2>(field);
-  // Field with noFirstLevel == true should have been adjusted to have 70 levels.
-  atlas::idx_t numLevels = field.shape(consts::eVertical);
-  if (noFirstLevel == true && numLevels == consts::kVerticalFullSize) {
+void monio::AtlasReader::populateFieldLevelsWithOwnerPlan(atlas::Field& field,
+                                      const std::shared_ptr<DataContainerBase>& dataContainer,
+                                      const std::size_t levelStart,
+                                      const std::size_t numLevels,
+                                      const OwnerPlan& ownerPlan) {
+  oops::Log::debug() << "AtlasReader::populateFieldLevelsWithOwnerPlan()" << std::endl;
+  if (levelStart + numLevels > std::size_t(field.shape(consts::eVertical))) {
+    Monio::get().closeFiles();
+    utils::throwException("AtlasReader::populateFieldLevelsWithOwnerPlan()> Levels exceed those "
+                          "of field \"" + field.name() + "\"...");
+  }
+  const std::vector<std::shared_ptr<DataContainerBase>> dataContainers{dataContainer};
+  const std::vector<std::size_t> slabLevelStarts{0};
+  const std::vector<std::size_t> slabNumLevels{numLevels};
+  scatterDataContainers(dataContainers, slabLevelStarts, slabNumLevels, ownerPlan,
+      [&](const std::size_t, const std::size_t,
+          const std::shared_ptr<DataContainerBase>& localData) {
+    unpackDataContainer(field, localData, 0, levelStart, numLevels, ownerPlan);
+  });
+}
+
+std::size_t monio::AtlasReader::getReadLevelStart(const atlas::Field& field,
+                                                  const consts::FieldMetadata& fieldMetadata,
+                                                  const bool isLfricConvention) {
+  return getReadLevelStart(field.shape(consts::eVertical), fieldMetadata, isLfricConvention);
+}
+
+std::size_t monio::AtlasReader::getReadLevelStart(const atlas::idx_t numLevels,
+                                                  const consts::FieldMetadata& fieldMetadata,
+                                                  const bool isLfricConvention) {
+  if (fieldMetadata.noFirstLevel == true && numLevels == consts::kVerticalFullSize) {
     Monio::get().closeFiles();
-    utils::throwException("AtlasReader::populateField()> Field levels misconfiguration...");
-  // Only valid case for field with noFirstLevel == true. Field is adjusted to have 70 levels but
-  // read data still has enough to fill 71.
-  } else if (isLfricConvention == true &&
-             noFirstLevel == true &&
+    utils::throwException("AtlasReader::getReadLevelStart()> Field levels misconfiguration...");
+  } else if (isLfricConvention == true && fieldMetadata.noFirstLevel == true &&
              numLevels == consts::kVerticalHalfSize) {
-    for (int j = 1; j < consts::kVerticalFullSize; ++j) {
-      for (std::size_t i = 0; i < lfricToAtlasMap.size(); ++i) {
-        int index = lfricToAtlasMap[i] + (j * lfricToAtlasMap.size());
-        // Bounds checking
-        if (std::size_t(index) <= dataVec.size()) {
-          fieldView(i, j - 1) = dataVec[index];
-        } else {
-          Monio::get().closeFiles();
-          utils::throwException("AtlasReader::populateField()> Calculated index exceeds size of "
-                                "data for field \"" + field.name() + "\".");
-        }
-      }
+    return 1;
+  }
+  return 0;
+}
+
+template<typename ContainerT, typename T>
+void monio::AtlasReader::scatterFileData(
+                        const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                        const std::vector<std::size_t>& levelStarts,
+                        const std::vector<std::size_t>& numLevels,
+                        const std::size_t groupStart,
+                        const std::size_t groupEnd,
+                        const std::size_t valuesPerPoint,
+                        const OwnerPlan& ownerPlan,
+                              std::vector<T>& localData) {
+  // Pack the data of each PE's points, in order of PE, directly from the read data
+  std::vector<T> sendBuffer;
+  if (ownerPlan.isMpiRankOwner() == true) {
+    sendBuffer.resize(ownerPlan.getGlobalSize() * valuesPerPoint);
+    std::size_t valueOffset = 0;
+    for (std::size_t i = groupStart; i < groupEnd; ++i) {
+      const std::shared_ptr<ContainerT> dataContainer =
+          std::static_pointer_cast<ContainerT>(dataContainers[i]);
+      ownerPlan.packFileData(dataContainer->getData(), levelStarts[i], numLevels[i], valueOffset,
+                             valuesPerPoint, sendBuffer, &threadPool_);
+      valueOffset += numLevels[i];
     }
-  // Valid case for isLfricConvention == false and fields noFirstLevel == false. Field is filled
-  // with all available data.
-  } else {
-    for (atlas::idx_t j = 0; j < numLevels; ++j) {
-      for (std::size_t i = 0; i < lfricToAtlasMap.size(); ++i) {
-        int index = lfricToAtlasMap[i] + (j * lfricToAtlasMap.size());
-        // Bounds checking
-        if (std::size_t(index) <= dataVec.size()) {
-          fieldView(i, j) = dataVec[index];
-        } else {
-          Monio::get().closeFiles();
-          utils::throwException("AtlasReader::populateField()> Calculated index exceeds size of "
-                                "data for field \"" + field.name() + "\".");
-        }
-      }
+  }
+  ownerPlan.scatter(sendBuffer, valuesPerPoint, localData);
+}
+
+template void monio::AtlasReader::scatterFileData<monio::DataContainerDouble, double>(
+                        const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                        const std::vector<std::size_t>& levelStarts,
+                        const std::vector<std::size_t>& numLevels,
+                        const std::size_t groupStart,
+                        const std::size_t groupEnd,
+                        const std::size_t valuesPerPoint,
+                        const OwnerPlan& ownerPlan,
+                              std::vector<double>& localData);
+template void monio::AtlasReader::scatterFileData<monio::DataContainerFloat, float>(
+                        const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                        const std::vector<std::size_t>& levelStarts,
+                        const std::vector<std::size_t>& numLevels,
+                        const std::size_t groupStart,
+                        const std::size_t groupEnd,
+                        const std::size_t valuesPerPoint,
+                        const OwnerPlan& ownerPlan,
+                              std::vector<float>& localData);
+template void monio::AtlasReader::scatterFileData<monio::DataContainerInt, int>(
+                        const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                        const std::vector<std::size_t>& levelStarts,
+                        const std::vector<std::size_t>& numLevels,
+                        const std::size_t groupStart,
+                        const std::size_t groupEnd,
+                        const std::size_t valuesPerPoint,
+                        const OwnerPlan& ownerPlan,
+                              std::vector<int>& localData);
+
+void monio::AtlasReader::unpackDataContainer(atlas::Field& field,
+                                       const std::shared_ptr<DataContainerBase>& localData,
+                                       const std::size_t dataOffset,
+                                       const std::size_t levelStart,
+                                       const std::size_t numLevels,
+                                       const OwnerPlan& ownerPlan) {
+  int dataType = localData.get()->getType();
+  switch (dataType) {
+    case consts::eDataTypes::eDouble: {
+      const std::shared_ptr<DataContainerDouble> localDataDouble =
+          std::static_pointer_cast<DataContainerDouble>(localData);
+      unpackLocalField(field, localDataDouble->getData().data() + dataOffset, levelStart,
+                       numLevels, ownerPlan);
+      break;
+    }
+    case consts::eDataTypes::eFloat: {
+      const std::shared_ptr<DataContainerFloat> localDataFloat =
+          std::static_pointer_cast<DataContainerFloat>(localData);
+      unpackLocalField(field, localDataFloat->getData().data() + dataOffset, levelStart,
+                       numLevels, ownerPlan);
+      break;
+    }
+    case consts::eDataTypes::eInt: {
+      const std::shared_ptr<DataContainerInt> localDataInt =
+          std::static_pointer_cast<DataContainerInt>(localData);
+      unpackLocalField(field, localDataInt->getData().data() + dataOffset, levelStart,
+                       numLevels, ownerPlan);
+      break;
+    }
+    default: {
+      Monio::get().closeFiles();
+      utils::throwException("AtlasReader::unpackDataContainer()> Data type not coded for...");
     }
   }
 }
 
-template void monio::AtlasReader::populateField<double>(atlas::Field& field,
-                                                        const std::vector<double>& dataVec,
-                                                        const std::vector<size_t>& lfricToAtlasMap,
-                                                        const bool copyFirstLevel,
-                                                        const bool isLfricConvention);
-template void monio::AtlasReader::populateField<float>(atlas::Field& field,
-                                                       const std::vector<float>& dataVec,
-                                                       const std::vector<size_t>& lfricToAtlasMap,
-                                                       const bool copyFirstLevel,
-                                                       const bool isLfricConvention);
-template void monio::AtlasReader::populateField<int>(atlas::Field& field,
-                                                     const std::vector<int>& dataVec,
-                                                     const std::vector<size_t>& lfricToAtlasMap,
-                                                     const bool copyFirstLevel,
-                                                     const bool isLfricConvention);
+template<typename FileT, typename FieldT>
+void monio::AtlasReader::redistributeToField(atlas::Field& field,
+                                       const std::vector<FileT>& blockVec,
+                                       const DistributionPlan& distributionPlan) {
+  if constexpr (remap::isConvertible<FileT, FieldT>()) {
+    auto fieldView = atlas::array::make_view<FieldT, 2>(field);
+    if (fieldView.stride(consts::eVertical) != 1) {
+      utils::throwException("AtlasReader::redistributeToField()> Levels of field \"" +
+                            field.name() + "\" are not contiguous...");
+    }
+    // Received data are placed directly in the field's storage
+    distributionPlan.blockToLocal(blockVec, fieldView.shape(consts::eVertical), fieldView.data(),
+                                  fieldView.stride(consts::eHorizontal));
+  } else {
+    utils::throwException("AtlasReader::redistributeToField()> Floating-point data cannot be "
+                          "read into integer field \"" + field.name() + "\"...");
+  }
+}
 
 template<typename T>
-void monio::AtlasReader::populateField(atlas::Field& field,
-                                       const std::vector<T>& dataVec) {
-  oops::Log::debug() << "AtlasReader::populateField()" << std::endl;
-
-  std::vector<atlas::idx_t> fieldShape = field.shape();
-  if (field.metadata().get<bool>("global") == false) {
-    fieldShape[consts::eHorizontal] = utilsatlas::getHorizontalSize(field);
+void monio::AtlasReader::populateLocalField(atlas::Field& field,
+                                      const std::vector<T>& blockVec,
+                                      const DistributionPlan& distributionPlan) {
+  oops::Log::debug() << "AtlasReader::populateLocalField()" << std::endl;
+  if (distributionPlan.getLocalSize() != std::size_t(utilsatlas::getHorizontalSize(field))) {
+    utils::throwException("AtlasReader::populateLocalField()> Distribution plan is not "
+                          "configured for field \"" + field.name() + "\".");
   }
-  auto fieldView = atlas::array::make_view<T, 2>(field);
-  for (atlas::idx_t i = 0; i < fieldShape[consts::eHorizontal]; ++i) {
-    for (atlas::idx_t j = 0; j < fieldShape[consts::eVertical]; ++j) {
-      atlas::idx_t index = i + (j * fieldShape[consts::eHorizontal]);
-      if (std::size_t(index) <= dataVec.size()) {
-        fieldView(i, j) = dataVec[index];
-      } else {
-        Monio::get().closeFiles();
-        utils::throwException("AtlasReader::populateField()> "
-                              "Calculated index exceeds size of data.");
-      }
+  // Data are converted from the file's type to the field's as they are redistributed
+  atlas::array::DataType atlasType = field.datatype();
+  switch (atlasType.kind()) {
+    case atlasType.KIND_REAL64: {
+      redistributeToField<T, double>(field, blockVec, distributionPlan);
+      break;
+    }
+    case atlasType.KIND_REAL32: {
+      redistributeToField<T, float>(field, blockVec, distributionPlan);
+      break;
+    }
+    case atlasType.KIND_INT32: {
+      redistributeToField<T, int>(field, blockVec, distributionPlan);
+      break;
+    }
+    default: {
+      utils::throwException("AtlasReader::populateLocalField()> Data type not coded for...");
     }
   }
 }
 
-template void monio::AtlasReader::populateField<double>(atlas::Field& field,
-                                                        const std::vector<double>& dataVec);
-template void monio::AtlasReader::populateField<float>(atlas::Field& field,
-                                                       const std::vector<float>& dataVec);
-template void monio::AtlasReader::populateField<int>(atlas::Field& field,
-                                                     const std::vector<int>& dataVec);
-
-atlas::Field monio::AtlasReader::getReadField(atlas::Field& field,
-                                              const bool noFirstLevel) {
-  // Check to ensure field has not been initialised with 71 levels
-  if (noFirstLevel == true && field.shape(consts::eVertical) == consts::kVerticalFullSize) {
-    atlas::array::DataType atlasType = field.datatype();
-    if (atlasType != atlasType.KIND_REAL64 &&
-        atlasType != atlasType.KIND_REAL32 &&
-        atlasType != atlasType.KIND_INT32) {
-        Monio::get().closeFiles();
-        utils::throwException("AtlasReader::getReadField())> Data type not coded for...");
-    }
-    atlas::util::Config atlasOptions = atlas::option::name(field.name()) |
-                                       atlas::option::levels(consts::kVerticalHalfSize) |
-                                       atlas::option::datatype(atlasType) |
-                                       atlas::option::global(0);
-    const auto& functionSpace = field.functionspace();
-    return functionSpace.createField(atlasOptions);
+template void monio::AtlasReader::populateLocalField<double>(atlas::Field& field,
+                                                       const std::vector<double>& blockVec,
+                                                       const DistributionPlan& distributionPlan);
+template void monio::AtlasReader::populateLocalField<float>(atlas::Field& field,
+                                                      const std::vector<float>& blockVec,
+                                                      const DistributionPlan& distributionPlan);
+template void monio::AtlasReader::populateLocalField<int>(atlas::Field& field,
+                                                    const std::vector<int>& blockVec,
+                                                    const DistributionPlan& distributionPlan);
+
+template<typename FileT, typename FieldT>
+void monio::AtlasReader::unpackToField(atlas::Field& field,
+                                 const FileT* localData,
+                                 const std::size_t levelStart,
+                                 const std::size_t numLevels,
+                                 const OwnerPlan& ownerPlan) {
+  if constexpr (remap::isConvertible<FileT, FieldT>()) {
+    auto fieldView = atlas::array::make_view<FieldT, 2>(field);
+    const std::vector<size_t>& localPoints = ownerPlan.getLocalPoints();
+    for (std::size_t i = 0; i < localPoints.size(); ++i) {
+      for (std::size_t j = 0; j < numLevels; ++j) {
+        fieldView(localPoints[i], levelStart + j) =
+            static_cast<FieldT>(localData[(i * numLevels) + j]);
+      }
+    }
+    field.set_dirty();
   } else {
-    return field;  // Case when field is initialised correctly.
+    Monio::get().closeFiles();
+    utils::throwException("AtlasReader::unpackToField()> Floating-point data cannot be read "
+                          "into integer field \"" + field.name() + "\"...");
+  }
+}
+
+template<typename T>
+void monio::AtlasReader::unpackLocalField(atlas::Field& field,
+                                    const T* localData,
+                                    const std::size_t levelStart,
+                                    const std::size_t numLevels,
+                                    const OwnerPlan& ownerPlan) {
+  // Data are converted from the file's type to the field's as they are unpacked
+  atlas::array::DataType atlasType = field.datatype();
+  switch (atlasType.kind()) {
+    case atlasType.KIND_REAL64: {
+      unpackToField<T, double>(field, localData, levelStart, numLevels, ownerPlan);
+      break;
+    }
+    case atlasType.KIND_REAL32: {
+      unpackToField<T, float>(field, localData, levelStart, numLevels, ownerPlan);
+      break;
+    }
+    case atlasType.KIND_INT32: {
+      unpackToField<T, int>(field, localData, levelStart, numLevels, ownerPlan);
+      break;
+    }
+    default: {
+      Monio::get().closeFiles();
+      utils::throwException("AtlasReader::unpackLocalField()> Data type not coded for...");
+    }
   }
 }
+
+template void monio::AtlasReader::unpackLocalField<double>(atlas::Field& field,
+                                                     const double* localData,
+                                                     const std::size_t levelStart,
+                                                     const std::size_t numLevels,
+                                                     const OwnerPlan& ownerPlan);
+template void monio::AtlasReader::unpackLocalField<float>(atlas::Field& field,
+                                                    const float* localData,
+                                                    const std::size_t levelStart,
+                                                    const std::size_t numLevels,
+                                                    const OwnerPlan& ownerPlan);
+template void monio::AtlasReader::unpackLocalField<int>(atlas::Field& field,
+                                                  const int* localData,
+                                                  const std::size_t levelStart,
+                                                  const std::size_t numLevels,
+                                                  const OwnerPlan& ownerPlan);
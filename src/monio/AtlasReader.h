@@ -8,6 +8,7 @@
 ******************************************************************************/
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -18,8 +19,11 @@
 #include "DataContainerDouble.h"
 #include "DataContainerFloat.h"
 #include "DataContainerInt.h"
+#include "DistributionPlan.h"
 #include "FileData.h"
 #include "Metadata.h"
+#include "OwnerPlan.h"
+#include "ThreadPool.h"
 
 #include "atlas/array/DataType.h"
 #include "atlas/field.h"
@@ -33,8 +37,11 @@ namespace monio {
 ///        populate Atlas fields with data read from files.
 class AtlasReader {
  public:
+  /// \brief The threads of the given pool pack read data for each PE on the owner PE in serial
+  ///        reads. The pool is owned by Monio, and outlives the reader.
   AtlasReader(const eckit::mpi::Comm& mpiCommunicator,
-              const int mpiRankOwner);
+              const int mpiRankOwner,
+                    ThreadPool& threadPool);
 
   AtlasReader()                               = delete;  //!< Deleted default constructor
   AtlasReader(AtlasReader&&)                  = delete;  //!< Deleted move constructor
@@ -42,44 +49,122 @@ class AtlasReader {
   AtlasReader& operator=( AtlasReader&&)      = delete;  //!< Deleted move assignment
   AtlasReader& operator=(const AtlasReader&)  = delete;  //!< Deleted copy assignment
 
-  /// \brief  Provides the entry point to the class by calling relevant, private functions.
-  ///         Including a call to get a field formatted for reading.
-  void populateFieldWithFileData(atlas::Field& field,
-                           const FileData& fileData,
-                           const consts::FieldMetadata& fieldMetadata,
-                           const std::string& readName,
-                           const bool isLfricConvention);
+  /// \brief Sets the PE rank that handles I/O. Where there are multiple owner PEs, each owner PE
+  ///        sets its own rank.
+  void setMpiRankOwner(const int mpiRankOwner);
 
- private:
-  /// \brief Called from the entry point. Derives container type, makes the call to populate a field
-  ///        with data.
-  void populateFieldWithDataContainer(atlas::Field& field,
-                                const std::shared_ptr<monio::DataContainerBase>& dataContainer,
-                                const std::vector<size_t>& lfricToAtlasMap,
-                                const bool noFirstLevel,
+  /// \brief Populates the locally-owned points of a decomposed field with a block of data read in
+  ///        parallel, by redistributing the blocks of all PEs. Called by all PEs.
+  void populateFieldWithBlockData(atlas::Field& field,
+                            const std::shared_ptr<monio::DataContainerBase>& dataContainer,
+                            const DistributionPlan& distributionPlan);
+
+  /// \brief Populates the locally-owned points of a batch of decomposed fields with data read by
+  ///        the plan's owner PE, which packs the points of each PE directly from the read data.
+  ///        Data containers are only required on the owner PE. Called by all PEs.
+  void populateFieldsWithOwnerPlan(std::vector<atlas::Field>& fields,
+                          const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                          const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                          const bool isLfricConvention,
+                          const OwnerPlan& ownerPlan);
+
+  /// \brief As above, where the data of each field start at an offset, in levels, within its data
+  ///        container, e.g. that of its time step where a container holds several. Offsets are
+  ///        only required on the owner PE.
+  void populateFieldsWithOwnerPlan(std::vector<atlas::Field>& fields,
+                          const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                          const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                          const std::vector<std::size_t>& levelOffsets,
+                          const bool isLfricConvention,
+                          const OwnerPlan& ownerPlan);
+
+  /// \brief Scatters a batch of read data from the plan's owner PE, which packs the points of each
+  ///        PE directly from the read data. Data are sent in their file's type. Each group of
+  ///        fields of one type that fits the limit of an MPI count is passed to unpackData as
+  ///        received by this PE, in a data container of that type. Data containers are only
+  ///        required on the owner PE. Called by all PEs.
+  void scatterDataContainers(
+                    const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                    const std::vector<std::size_t>& levelStarts,
+                    const std::vector<std::size_t>& numLevels,
+                    const OwnerPlan& ownerPlan,
+                    const std::function<void(const std::size_t groupStart,
+                                             const std::size_t groupEnd,
+                          const std::shared_ptr<DataContainerBase>& localData)>& unpackData);
+
+  /// \brief Populates a slab of levels of the locally-owned points of a decomposed field, with data
+  ///        read by the plan's owner PE. The data container holds the slab's levels only, and is
+  ///        only required on the owner PE. Called by all PEs.
+  void populateFieldLevelsWithOwnerPlan(atlas::Field& field,
+                                  const std::shared_ptr<DataContainerBase>& dataContainer,
+                                  const std::size_t levelStart,
+                                  const std::size_t numLevels,
+                                  const OwnerPlan& ownerPlan);
+
+  /// \brief Returns the first file level read for a field, after checking its configuration.
+  ///        Fields without a first level skip the surface level of LFRic full-level variables.
+  std::size_t getReadLevelStart(const atlas::Field& field,
+                                const consts::FieldMetadata& fieldMetadata,
                                 const bool isLfricConvention);
 
-  /// \brief Not currently used, but could be. Derives container type, makes the call to populate a
-  ///        field with data where data order isn't relevant.
-  void populateFieldWithDataContainer(atlas::Field& field,
-                                const std::shared_ptr<monio::DataContainerBase>& dataContainer);
+  /// \brief Returns the first file level read for a field with a given number of levels.
+  std::size_t getReadLevelStart(const atlas::idx_t numLevels,
+                                const consts::FieldMetadata& fieldMetadata,
+                                const bool isLfricConvention);
+
+ private:
+  /// \brief Redistributes block data and populates the locally-owned points of a field. Data are
+  ///        converted where the field's type differs from theirs.
+  template<typename T> void populateLocalField(atlas::Field& field,
+                                         const std::vector<T>& blockVec,
+                                         const DistributionPlan& distributionPlan);
+
+  /// \brief Redistributes block data of type FileT straight into the storage of a field of type
+  ///        FieldT, without an intermediate copy. Integer fields are only populated with integer
+  ///        data.
+  template<typename FileT, typename FieldT> void redistributeToField(atlas::Field& field,
+                                                        const std::vector<FileT>& blockVec,
+                                                        const DistributionPlan& distributionPlan);
+
+  /// \brief Packs a group of read data containers of type ContainerT, for the points of all PEs,
+  ///        and scatters them from the plan's owner PE (see OwnerPlan::packFileData).
+  template<typename ContainerT, typename T> void scatterFileData(
+                          const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                          const std::vector<std::size_t>& levelStarts,
+                          const std::vector<std::size_t>& numLevels,
+                          const std::size_t groupStart,
+                          const std::size_t groupEnd,
+                          const std::size_t valuesPerPoint,
+                          const OwnerPlan& ownerPlan,
+                                std::vector<T>& localData);
 
-  /// \brief Provides function to populate a field with read data and skips data on zeroth level
-  ///        where applicable.
-  template<typename T> void populateField(atlas::Field& field,
-                                    const std::vector<T>& dataVec,
-                                    const std::vector<size_t>& lfricToAtlasMap,
-                                    const bool noFirstLevel,
-                                    const bool isLfricConvention);
+  /// \brief Derives the type of scattered data and populates a range of levels of the
+  ///        locally-owned points of a field with those starting at dataOffset.
+  void unpackDataContainer(atlas::Field& field,
+                     const std::shared_ptr<DataContainerBase>& localData,
+                     const std::size_t dataOffset,
+                     const std::size_t levelStart,
+                     const std::size_t numLevels,
+                     const OwnerPlan& ownerPlan);
 
-  /// \brief Not currently used, but used to populate a field where data order isn't relevant.
-  template<typename T> void populateField(atlas::Field& field,
-                                    const std::vector<T>& dataVec);
+  /// \brief Populates a range of levels of the locally-owned points of a field with scattered
+  ///        data. Data are converted where the field's type differs from theirs.
+  template<typename T> void unpackLocalField(atlas::Field& field,
+                                       const T* localData,
+                                       const std::size_t levelStart,
+                                       const std::size_t numLevels,
+                                       const OwnerPlan& ownerPlan);
 
-  /// \brief Returns a formatted field without a zeroth level, where applicable.
-  atlas::Field getReadField(atlas::Field& inputField, const bool noFirstLevel);
+  /// \brief Populates a range of levels of a field of type FieldT with scattered data of type
+  ///        FileT. Integer fields are only populated with integer data.
+  template<typename FileT, typename FieldT> void unpackToField(atlas::Field& field,
+                                                        const FileT* localData,
+                                                        const std::size_t levelStart,
+                                                        const std::size_t numLevels,
+                                                        const OwnerPlan& ownerPlan);
 
   const eckit::mpi::Comm& mpiCommunicator_;
-  const std::size_t mpiRankOwner_;
+  std::size_t mpiRankOwner_;
+  ThreadPool& threadPool_;
 };
 }  // namespace monio
@@ -9,6 +9,8 @@
 ******************************************************************************/
 #include "AtlasWriter.h"
 
+#include <algorithm>
+
 #include "atlas/grid/Iterator.h"
 #include "oops/util/Logger.h"
 
@@ -18,16 +20,25 @@
 #include "DataContainerInt.h"
 #include "Metadata.h"
 #include "Monio.h"
+#include "Remap.h"
 #include "Utils.h"
 #include "UtilsAtlas.h"
 #include "Writer.h"
 
-monio::AtlasWriter::AtlasWriter(const eckit::mpi::Comm& mpiCommunicator, const int mpiRankOwner):
+monio::AtlasWriter::AtlasWriter(const eckit::mpi::Comm& mpiCommunicator,
+                                const int mpiRankOwner,
+                                      ThreadPool& threadPool):
     mpiCommunicator_(mpiCommunicator),
-    mpiRankOwner_(mpiRankOwner) {
+    mpiRankOwner_(mpiRankOwner),
+    threadPool_(threadPool) {
   oops::Log::debug() << "AtlasWriter::AtlasWriter()" << std::endl;
 }
 
+void monio::AtlasWriter::setMpiRankOwner(const int mpiRankOwner) {
+  oops::Log::debug() << "AtlasWriter::setMpiRankOwner()" << std::endl;
+  mpiRankOwner_ = mpiRankOwner;
+}
+
 void monio::AtlasWriter::populateFileDataWithField(FileData& fileData,
                                                    atlas::Field& field,
                                              const consts::FieldMetadata& fieldMetadata,
@@ -45,8 +56,10 @@ void monio::AtlasWriter::populateFileDataWithField(FileData& fileData,
     } else {
       writeField = field;
     }
-    populateMetadataWithField(metadata, writeField, fieldMetadata, writeName, vertConfigName);
-    populateDataWithField(fileData.getData(), writeField, lfricAtlasMap, writeName);
+    int fileDataType = utilsatlas::getFileDataType(writeField, fieldMetadata);
+    populateMetadataWithField(metadata, fileDataType, writeField, fieldMetadata, writeName,
+                              vertConfigName);
+    populateDataWithField(fileData.getData(), writeField, lfricAtlasMap, writeName, fileDataType);
     addGlobalAttributes(metadata, isLfricConvention);
   }
 }
@@ -95,18 +108,210 @@ void monio::AtlasWriter::populateFileDataWithField(FileData& fileData,
   }
 }
 
+void monio::AtlasWriter::populateMetadataWithLocalField(Metadata& metadata,
+                                                  const atlas::Field& field,
+                                                  const consts::FieldMetadata& fieldMetadata,
+                                                  const std::string& writeName,
+                                                  const std::string& vertConfigName,
+                                                  const bool isLfricConvention) {
+  oops::Log::debug() << "AtlasWriter::populateMetadataWithLocalField()" << std::endl;
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    // Global shape of the written variable, as the field is decomposed
+    std::vector<atlas::idx_t> fieldShape = {
+        metadata.getDimension(std::string(consts::kHorizontalName)),
+        getWriteLevels(field, writeName, fieldMetadata.noFirstLevel, isLfricConvention)};
+    populateMetadataWithField(metadata, utilsatlas::getFileDataType(field, fieldMetadata),
+                              fieldShape, fieldMetadata, writeName, vertConfigName);
+    addGlobalAttributes(metadata, isLfricConvention);
+  }
+}
+
+void monio::AtlasWriter::populateBlockDataWithField(
+                                     std::shared_ptr<monio::DataContainerBase>& dataContainer,
+                               const atlas::Field& field,
+                               const consts::FieldMetadata& fieldMetadata,
+                               const std::string& writeName,
+                               const bool isLfricConvention,
+                               const DistributionPlan& distributionPlan) {
+  oops::Log::debug() << "AtlasWriter::populateBlockDataWithField()" << std::endl;
+  atlas::idx_t writeLevels = getWriteLevels(field, writeName, fieldMetadata.noFirstLevel,
+                                            isLfricConvention);
+  atlas::array::DataType atlasType = field.datatype();
+  if (utilsatlas::getFileDataType(field, fieldMetadata) !=
+      utilsatlas::atlasTypeToMonioEnum(atlasType)) {
+    Monio::get().closeFiles();
+    utils::throwException("AtlasWriter::populateBlockDataWithField()> Field \"" + field.name() +
+                          "\" cannot be converted to another data type in parallel writing...");
+  }
+  switch (atlasType.kind()) {
+    case atlasType.KIND_INT32: {
+      std::shared_ptr<DataContainerInt> dataContainerInt =
+                        std::make_shared<DataContainerInt>(writeName);
+      populateBlockDataVec(dataContainerInt->getData(), field, writeLevels, distributionPlan);
+      dataContainer = dataContainerInt;
+      break;
+    }
+    case atlasType.KIND_REAL32: {
+      std::shared_ptr<DataContainerFloat> dataContainerFloat =
+                        std::make_shared<DataContainerFloat>(writeName);
+      populateBlockDataVec(dataContainerFloat->getData(), field, writeLevels, distributionPlan);
+      dataContainer = dataContainerFloat;
+      break;
+    }
+    case atlasType.KIND_REAL64: {
+      std::shared_ptr<DataContainerDouble> dataContainerDouble =
+                        std::make_shared<DataContainerDouble>(writeName);
+      populateBlockDataVec(dataContainerDouble->getData(), field, writeLevels, distributionPlan);
+      dataContainer = dataContainerDouble;
+      break;
+    }
+    default: {
+      Monio::get().closeFiles();
+      utils::throwException("AtlasWriter::populateBlockDataWithField()> "
+                            "Data type not coded for...");
+    }
+  }
+}
+
+void monio::AtlasWriter::populateFileDataWithLocalFields(FileData& fileData,
+                                   const std::vector<atlas::Field>& fields,
+                                   const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                   const std::vector<std::string>& writeNames,
+                                   const std::vector<std::string>& vertConfigNames,
+                                   const bool isLfricConvention,
+                                   const OwnerPlan& ownerPlan) {
+  oops::Log::debug() << "AtlasWriter::populateFileDataWithLocalFields()" << std::endl;
+  if (fields.size() != fieldMetadataVec.size() || fields.size() != writeNames.size()) {
+    Monio::get().closeFiles();
+    utils::throwException("AtlasWriter::populateFileDataWithLocalFields()> "
+                          "Numbers of fields and metadata do not match...");
+  }
+  std::vector<int> dataTypes(fields.size());
+  std::vector<atlas::idx_t> writeLevels(fields.size());
+  for (std::size_t i = 0; i < fields.size(); ++i) {
+    writeLevels[i] = getWriteLevels(fields[i], writeNames[i], fieldMetadataVec[i].noFirstLevel,
+                                    isLfricConvention);
+    dataTypes[i] = utilsatlas::getFileDataType(fields[i], fieldMetadataVec[i]);
+  }
+  // Pack the locally-owned points of each group of fields, in their file's type
+  populateFileDataWithLocalData(fileData,
+      [&](const std::size_t groupStart, const std::size_t groupEnd,
+          const std::shared_ptr<DataContainerBase>& localData) {
+    for (std::size_t i = groupStart; i < groupEnd; ++i) {
+      packDataContainer(localData, fields[i], writeLevels[i], 0, writeLevels[i], ownerPlan);
+    }
+  }, dataTypes, writeLevels, fieldMetadataVec, writeNames, vertConfigNames, isLfricConvention,
+     ownerPlan);
+}
+
+void monio::AtlasWriter::populateFileDataWithLocalData(FileData& fileData,
+                  const std::function<void(const std::size_t groupStart,
+                                           const std::size_t groupEnd,
+                          const std::shared_ptr<DataContainerBase>& localData)>& packData,
+                                   const std::vector<int>& dataTypes,
+                                   const std::vector<atlas::idx_t>& writeLevels,
+                                   const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                   const std::vector<std::string>& writeNames,
+                                   const std::vector<std::string>& vertConfigNames,
+                                   const bool isLfricConvention,
+                                   const OwnerPlan& ownerPlan) {
+  oops::Log::debug() << "AtlasWriter::populateFileDataWithLocalData()" << std::endl;
+  std::size_t numFields = fieldMetadataVec.size();
+  if (dataTypes.size() != numFields || writeLevels.size() != numFields ||
+      writeNames.size() != numFields || vertConfigNames.size() != numFields) {
+    Monio::get().closeFiles();
+    utils::throwException("AtlasWriter::populateFileDataWithLocalData()> "
+                          "Numbers of fields and metadata do not match...");
+  }
+  const bool isOwner = ownerPlan.isMpiRankOwner();
+  std::vector<std::shared_ptr<DataContainerBase>> dataContainers(numFields);
+  for (std::size_t i = 0; i < numFields; ++i) {
+    if (isOwner == true) {
+      std::vector<atlas::idx_t> fieldShape = {atlas::idx_t(ownerPlan.getGlobalSize()),
+                                              writeLevels[i]};
+      populateMetadataWithField(fileData.getMetadata(), dataTypes[i], fieldShape,
+                                fieldMetadataVec[i], writeNames[i], vertConfigNames[i]);
+      dataContainers[i] = createDataContainer(dataTypes[i], writeNames[i],
+                                              ownerPlan.getGlobalSize() * writeLevels[i]);
+    }
+  }
+  // Data are exchanged in their file's type, so fields are gathered in groups of one type
+  std::size_t groupStart = 0;
+  while (groupStart < numFields) {
+    std::size_t groupEnd = groupStart;
+    std::size_t valuesPerPoint = 0;
+    while (groupEnd < numFields && dataTypes[groupEnd] == dataTypes[groupStart]) {
+      valuesPerPoint += writeLevels[groupEnd];
+      ++groupEnd;
+    }
+    std::shared_ptr<DataContainerBase> localData = createDataContainer(dataTypes[groupStart],
+                                                                       "", 0);
+    packData(groupStart, groupEnd, localData);
+    gatherDataContainer(localData, dataContainers, writeLevels, groupStart, groupEnd,
+                        valuesPerPoint, ownerPlan);
+    groupStart = groupEnd;
+  }
+  if (isOwner == true) {
+    for (const auto& dataContainer : dataContainers) {
+      fileData.getData().addContainer(dataContainer);
+    }
+    addGlobalAttributes(fileData.getMetadata(), isLfricConvention);
+  }
+}
+
+void monio::AtlasWriter::populateDataContainerWithLocalField(
+                                     std::shared_ptr<monio::DataContainerBase>& dataContainer,
+                               const atlas::Field& field,
+                               const int fileDataType,
+                               const std::string& writeName,
+                               const atlas::idx_t writeLevels,
+                               const std::size_t levelStart,
+                               const std::size_t numLevels,
+                               const OwnerPlan& ownerPlan) {
+  oops::Log::debug() << "AtlasWriter::populateDataContainerWithLocalField()" << std::endl;
+  if (levelStart + numLevels > std::size_t(writeLevels)) {
+    Monio::get().closeFiles();
+    utils::throwException("AtlasWriter::populateDataContainerWithLocalField()> Levels exceed "
+                          "those written for field \"" + field.name() + "\"...");
+  }
+  // The slab is packed in the file's type
+  std::shared_ptr<DataContainerBase> localData = createDataContainer(fileDataType, "", 0);
+  packDataContainer(localData, field, writeLevels, levelStart, numLevels, ownerPlan);
+  if (ownerPlan.isMpiRankOwner() == true) {
+    dataContainer = createDataContainer(fileDataType, writeName,
+                                        ownerPlan.getGlobalSize() * numLevels);
+  }
+  const std::vector<std::shared_ptr<DataContainerBase>> dataContainers{dataContainer};
+  const std::vector<atlas::idx_t> slabLevels{atlas::idx_t(numLevels)};
+  gatherDataContainer(localData, dataContainers, slabLevels, 0, 1, numLevels, ownerPlan);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void monio::AtlasWriter::populateMetadataWithField(Metadata& metadata,
+                                             const int type,
                                              const atlas::Field& field,
                                              const consts::FieldMetadata& fieldMetadata,
                                              const std::string& varName,
                                              const std::string& vertConfigName) {
   oops::Log::debug() << "AtlasWriter::populateMetadataWithField()" << std::endl;
-  int type = utilsatlas::atlasTypeToMonioEnum(field.datatype());
+  std::vector<atlas::idx_t> fieldShape = field.shape();
+  if (field.metadata().get<bool>("global") == false) {
+    fieldShape[consts::eHorizontal] = utilsatlas::getHorizontalSize(field);
+  }
+  populateMetadataWithField(metadata, type, fieldShape, fieldMetadata, varName, vertConfigName);
+}
+
+void monio::AtlasWriter::populateMetadataWithField(Metadata& metadata,
+                                             const int type,
+                                             const std::vector<atlas::idx_t>& fieldShape,
+                                             const consts::FieldMetadata& fieldMetadata,
+                                             const std::string& varName,
+                                             const std::string& vertConfigName) {
+  oops::Log::debug() << "AtlasWriter::populateMetadataWithField()" << std::endl;
   std::shared_ptr<monio::Variable> var = std::make_shared<Variable>(varName, type);
   // Variable dimensions
-  addVariableDimensions(field, metadata, var, vertConfigName);
+  addVariableDimensions(fieldShape, metadata, var, vertConfigName);
   // Variable attributes
   for (int i = 0; i < consts::eNumberOfAttributeNames; ++i) {
     std::string attributeName = std::string(consts::kIncrementAttributeNames[i]);
@@ -145,10 +350,11 @@ void monio::AtlasWriter::populateMetadataWithField(Metadata& metadata,
 void monio::AtlasWriter::populateDataWithField(Data& data,
                                          const atlas::Field& field,
                                          const std::vector<size_t>& lfricToAtlasMap,
-                                         const std::string& fieldName) {
+                                         const std::string& fieldName,
+                                         const int fileDataType) {
   oops::Log::debug() << "AtlasWriter::populateDataWithField()" << std::endl;
   std::shared_ptr<DataContainerBase> dataContainer = nullptr;
-  populateDataContainerWithField(dataContainer, field, lfricToAtlasMap, fieldName);
+  populateDataContainerWithField(dataContainer, field, lfricToAtlasMap, fieldName, fileDataType);
   data.addContainer(dataContainer);
 }
 
@@ -165,13 +371,14 @@ void monio::AtlasWriter::populateDataContainerWithField(
                                      std::shared_ptr<monio::DataContainerBase>& dataContainer,
                                const atlas::Field& field,
                                const std::vector<size_t>& lfricToAtlasMap,
-                               const std::string& fieldName) {
+                               const std::string& fieldName,
+                               const int fileDataType) {
   oops::Log::debug() << "AtlasWriter::populateDataContainerWithField()" << std::endl;
   if (mpiCommunicator_.rank() == mpiRankOwner_) {
-    atlas::array::DataType atlasType = field.datatype();
     atlas::idx_t fieldSize = utilsatlas::getGlobalDataSize(field);
-    switch (atlasType.kind()) {
-      case atlasType.KIND_INT32: {
+    // The container holds the file's data type, to which field data are converted
+    switch (fileDataType) {
+      case consts::eDataTypes::eInt: {
         if (dataContainer == nullptr) {
           dataContainer = std::make_shared<DataContainerInt>(fieldName);
         }
@@ -182,7 +389,7 @@ void monio::AtlasWriter::populateDataContainerWithField(
         populateDataVec(dataContainerInt->getData(), field, lfricToAtlasMap);
         break;
       }
-      case atlasType.KIND_REAL32: {
+      case consts::eDataTypes::eFloat: {
         if (dataContainer == nullptr) {
           dataContainer = std::make_shared<DataContainerFloat>(fieldName);
         }
@@ -193,7 +400,7 @@ void monio::AtlasWriter::populateDataContainerWithField(
         populateDataVec(dataContainerFloat->getData(), field, lfricToAtlasMap);
         break;
       }
-      case atlasType.KIND_REAL64: {
+      case consts::eDataTypes::eDouble: {
         if (dataContainer == nullptr) {
           dataContainer = std::make_shared<DataContainerDouble>(fieldName);
         }
@@ -265,6 +472,28 @@ void monio::AtlasWriter::populateDataContainerWithField(
   }
 }
 
+template<typename FieldT, typename FileT>
+void monio::AtlasWriter::remapFromField(std::vector<FileT>& dataVec,
+                                  const atlas::Field& field,
+                                  const std::vector<size_t>& lfricToAtlasMap) {
+  if constexpr (remap::isConvertible<FieldT, FileT>()) {
+    auto fieldView = atlas::array::make_view<FieldT, 2>(field);
+    if (fieldView.stride(consts::eVertical) != 1) {
+      Monio::get().closeFiles();
+      utils::throwException("AtlasWriter::remapFromField()> Levels of field \"" + field.name() +
+                            "\" are not contiguous...");
+    }
+    remap::fieldToFile(fieldView.data(), fieldView.stride(consts::eHorizontal),
+                       lfricToAtlasMap.data(), lfricToAtlasMap.size(),
+                       fieldView.shape(consts::eVertical), dataVec.data(), lfricToAtlasMap.size(),
+                       &threadPool_);
+  } else {
+    Monio::get().closeFiles();
+    utils::throwException("AtlasWriter::remapFromField()> Floating-point field \"" +
+                          field.name() + "\" cannot be written as integer data...");
+  }
+}
+
 template<typename T>
 void monio::AtlasWriter::populateDataVec(std::vector<T>& dataVec,
                                    const atlas::Field& field,
@@ -276,11 +505,24 @@ void monio::AtlasWriter::populateDataVec(std::vector<T>& dataVec,
     utils::throwException("AtlasWriter::populateDataVec()> "
                           "Data container is not configured for the expected data...");
   }
-  auto fieldView = atlas::array::make_view<T, 2>(field);
-  for (std::size_t i = 0; i < lfricToAtlasMap.size(); ++i) {
-    for (atlas::idx_t j = 0; j < numLevels; ++j) {
-      atlas::idx_t index = lfricToAtlasMap[i] + (j * lfricToAtlasMap.size());
-      dataVec[index] = fieldView(i, j);
+  // Field data are converted to the container's type as they are remapped
+  atlas::array::DataType atlasType = field.datatype();
+  switch (atlasType.kind()) {
+    case atlasType.KIND_REAL64: {
+      remapFromField<double, T>(dataVec, field, lfricToAtlasMap);
+      break;
+    }
+    case atlasType.KIND_REAL32: {
+      remapFromField<float, T>(dataVec, field, lfricToAtlasMap);
+      break;
+    }
+    case atlasType.KIND_INT32: {
+      remapFromField<int, T>(dataVec, field, lfricToAtlasMap);
+      break;
+    }
+    default: {
+      Monio::get().closeFiles();
+      utils::throwException("AtlasWriter::populateDataVec()> Data type not coded for...");
     }
   }
 }
@@ -319,6 +561,290 @@ template void monio::AtlasWriter::populateDataVec<int>(std::vector<int>& dataVec
                                                  const atlas::Field& field,
                                                  const std::vector<atlas::idx_t>& dimensions);
 
+template<typename T>
+void monio::AtlasWriter::populateBlockDataVec(std::vector<T>& blockVec,
+                                        const atlas::Field& field,
+                                        const atlas::idx_t writeLevels,
+                                        const DistributionPlan& distributionPlan) {
+  oops::Log::debug() << "AtlasWriter::populateBlockDataVec() " << field.name() << std::endl;
+  std::size_t localSize = distributionPlan.getLocalSize();
+  if (localSize != std::size_t(utilsatlas::getHorizontalSize(field))) {
+    utils::throwException("AtlasWriter::populateBlockDataVec()> Distribution plan is not "
+                          "configured for field \"" + field.name() + "\".");
+  }
+  atlas::idx_t numLevels = field.shape(consts::eVertical);
+  atlas::idx_t levelOffset = writeLevels - numLevels;  // Levels below the field's surface level
+  std::vector<T> localVec(localSize * writeLevels);
+  auto fieldView = atlas::array::make_view<T, 2>(field);
+  for (std::size_t i = 0; i < localSize; ++i) {
+    for (atlas::idx_t j = 0; j < levelOffset; ++j) {
+      localVec[(i * writeLevels) + j] = fieldView(i, 0);
+    }
+    for (atlas::idx_t j = 0; j < numLevels; ++j) {
+      localVec[(i * writeLevels) + levelOffset + j] = fieldView(i, j);
+    }
+  }
+  distributionPlan.localToBlock(localVec, writeLevels, blockVec);
+}
+
+template void monio::AtlasWriter::populateBlockDataVec<double>(std::vector<double>& blockVec,
+                                                  const atlas::Field& field,
+                                                  const atlas::idx_t writeLevels,
+                                                  const DistributionPlan& distributionPlan);
+template void monio::AtlasWriter::populateBlockDataVec<float>(std::vector<float>& blockVec,
+                                                  const atlas::Field& field,
+                                                  const atlas::idx_t writeLevels,
+                                                  const DistributionPlan& distributionPlan);
+template void monio::AtlasWriter::populateBlockDataVec<int>(std::vector<int>& blockVec,
+                                                  const atlas::Field& field,
+                                                  const atlas::idx_t writeLevels,
+                                                  const DistributionPlan& distributionPlan);
+
+void monio::AtlasWriter::packDataContainer(const std::shared_ptr<DataContainerBase>& localData,
+                                           const atlas::Field& field,
+                                           const atlas::idx_t writeLevels,
+                                           const std::size_t levelStart,
+                                           const std::size_t numLevels,
+                                           const OwnerPlan& ownerPlan) {
+  int dataType = localData.get()->getType();
+  switch (dataType) {
+    case consts::eDataTypes::eDouble: {
+      std::shared_ptr<DataContainerDouble> localDataDouble =
+                        std::static_pointer_cast<DataContainerDouble>(localData);
+      packLocalField(localDataDouble->getData(), field, writeLevels, levelStart, numLevels,
+                     ownerPlan);
+      break;
+    }
+    case consts::eDataTypes::eFloat: {
+      std::shared_ptr<DataContainerFloat> localDataFloat =
+                        std::static_pointer_cast<DataContainerFloat>(localData);
+      packLocalField(localDataFloat->getData(), field, writeLevels, levelStart, numLevels,
+                     ownerPlan);
+      break;
+    }
+    case consts::eDataTypes::eInt: {
+      std::shared_ptr<DataContainerInt> localDataInt =
+                        std::static_pointer_cast<DataContainerInt>(localData);
+      packLocalField(localDataInt->getData(), field, writeLevels, levelStart, numLevels,
+                     ownerPlan);
+      break;
+    }
+    default: {
+      Monio::get().closeFiles();
+      utils::throwException("AtlasWriter::packDataContainer()> Data type not coded for...");
+    }
+  }
+}
+
+template<typename T>
+void monio::AtlasWriter::packLocalField(std::vector<T>& localData,
+                                  const atlas::Field& field,
+                                  const atlas::idx_t writeLevels,
+                                  const std::size_t levelStart,
+                                  const std::size_t numLevels,
+                                  const OwnerPlan& ownerPlan) {
+  // Data are converted from the field's type to the file's as they are packed
+  atlas::array::DataType atlasType = field.datatype();
+  switch (atlasType.kind()) {
+    case atlasType.KIND_REAL64: {
+      packFromField<double, T>(localData, field, writeLevels, levelStart, numLevels, ownerPlan);
+      break;
+    }
+    case atlasType.KIND_REAL32: {
+      packFromField<float, T>(localData, field, writeLevels, levelStart, numLevels, ownerPlan);
+      break;
+    }
+    case atlasType.KIND_INT32: {
+      packFromField<int, T>(localData, field, writeLevels, levelStart, numLevels, ownerPlan);
+      break;
+    }
+    default: {
+      Monio::get().closeFiles();
+      utils::throwException("AtlasWriter::packLocalField()> Data type not coded for...");
+    }
+  }
+}
+
+template void monio::AtlasWriter::packLocalField<double>(std::vector<double>& localData,
+                                                   const atlas::Field& field,
+                                                   const atlas::idx_t writeLevels,
+                                                   const std::size_t levelStart,
+                                                   const std::size_t numLevels,
+                                                   const OwnerPlan& ownerPlan);
+template void monio::AtlasWriter::packLocalField<float>(std::vector<float>& localData,
+                                                  const atlas::Field& field,
+                                                  const atlas::idx_t writeLevels,
+                                                  const std::size_t levelStart,
+                                                  const std::size_t numLevels,
+                                                  const OwnerPlan& ownerPlan);
+template void monio::AtlasWriter::packLocalField<int>(std::vector<int>& localData,
+                                                const atlas::Field& field,
+                                                const atlas::idx_t writeLevels,
+                                                const std::size_t levelStart,
+                                                const std::size_t numLevels,
+                                                const OwnerPlan& ownerPlan);
+
+template<typename FieldT, typename FileT>
+void monio::AtlasWriter::packFromField(std::vector<FileT>& localData,
+                                 const atlas::Field& field,
+                                 const atlas::idx_t writeLevels,
+                                 const std::size_t levelStart,
+                                 const std::size_t numLevels,
+                                 const OwnerPlan& ownerPlan) {
+  if constexpr (remap::isConvertible<FieldT, FileT>()) {
+    atlas::idx_t levelOffset = writeLevels - field.shape(consts::eVertical);
+    auto fieldView = atlas::array::make_view<FieldT, 2>(field);
+    localData.reserve(localData.size() + (ownerPlan.getLocalSize() * numLevels));
+    for (const std::size_t point : ownerPlan.getLocalPoints()) {
+      for (std::size_t j = levelStart; j < levelStart + numLevels; ++j) {
+        // Levels below the field's surface level are copies of it
+        atlas::idx_t fieldLevel = std::max(atlas::idx_t(j) - levelOffset, atlas::idx_t(0));
+        localData.push_back(static_cast<FileT>(fieldView(point, fieldLevel)));
+      }
+    }
+  } else {
+    Monio::get().closeFiles();
+    utils::throwException("AtlasWriter::packFromField()> Floating-point field \"" +
+                          field.name() + "\" cannot be written as integer data...");
+  }
+}
+
+void monio::AtlasWriter::gatherDataContainer(const std::shared_ptr<DataContainerBase>& localData,
+                        const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                        const std::vector<atlas::idx_t>& numLevels,
+                        const std::size_t groupStart,
+                        const std::size_t groupEnd,
+                        const std::size_t valuesPerPoint,
+                        const OwnerPlan& ownerPlan) {
+  int dataType = localData.get()->getType();
+  switch (dataType) {
+    case consts::eDataTypes::eDouble: {
+      std::shared_ptr<DataContainerDouble> localDataDouble =
+                        std::static_pointer_cast<DataContainerDouble>(localData);
+      gatherFileData<DataContainerDouble>(localDataDouble->getData(), dataContainers, numLevels,
+                                          groupStart, groupEnd, valuesPerPoint, ownerPlan);
+      break;
+    }
+    case consts::eDataTypes::eFloat: {
+      std::shared_ptr<DataContainerFloat> localDataFloat =
+                        std::static_pointer_cast<DataContainerFloat>(localData);
+      gatherFileData<DataContainerFloat>(localDataFloat->getData(), dataContainers, numLevels,
+                                         groupStart, groupEnd, valuesPerPoint, ownerPlan);
+      break;
+    }
+    case consts::eDataTypes::eInt: {
+      std::shared_ptr<DataContainerInt> localDataInt =
+                        std::static_pointer_cast<DataContainerInt>(localData);
+      gatherFileData<DataContainerInt>(localDataInt->getData(), dataContainers, numLevels,
+                                       groupStart, groupEnd, valuesPerPoint, ownerPlan);
+      break;
+    }
+    default: {
+      Monio::get().closeFiles();
+      utils::throwException("AtlasWriter::gatherDataContainer()> Data type not coded for...");
+    }
+  }
+}
+
+template<typename ContainerT, typename T>
+void monio::AtlasWriter::gatherFileData(const std::vector<T>& localData,
+                        const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                        const std::vector<atlas::idx_t>& numLevels,
+                        const std::size_t groupStart,
+                        const std::size_t groupEnd,
+                        const std::size_t valuesPerPoint,
+                        const OwnerPlan& ownerPlan) {
+  // The data of each PE are unpacked into file order as they arrive at the owner PE
+  ownerPlan.gather<T>(localData, valuesPerPoint, [&](const std::size_t pe, const T* peData) {
+    for (std::size_t i = groupStart; i < groupEnd; ++i) {
+      std::shared_ptr<ContainerT> dataContainer =
+                        std::static_pointer_cast<ContainerT>(dataContainers[i]);
+      ownerPlan.unpackFileData(peData, numLevels[i], pe, dataContainer->getData(), &threadPool_);
+      peData += ownerPlan.getPointCount(pe) * numLevels[i];
+    }
+  });
+}
+
+template void monio::AtlasWriter::gatherFileData<monio::DataContainerDouble, double>(
+                        const std::vector<double>& localData,
+                        const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                        const std::vector<atlas::idx_t>& numLevels,
+                        const std::size_t groupStart,
+                        const std::size_t groupEnd,
+                        const std::size_t valuesPerPoint,
+                        const OwnerPlan& ownerPlan);
+template void monio::AtlasWriter::gatherFileData<monio::DataContainerFloat, float>(
+                        const std::vector<float>& localData,
+                        const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                        const std::vector<atlas::idx_t>& numLevels,
+                        const std::size_t groupStart,
+                        const std::size_t groupEnd,
+                        const std::size_t valuesPerPoint,
+                        const OwnerPlan& ownerPlan);
+template void monio::AtlasWriter::gatherFileData<monio::DataContainerInt, int>(
+                        const std::vector<int>& localData,
+                        const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                        const std::vector<atlas::idx_t>& numLevels,
+                        const std::size_t groupStart,
+                        const std::size_t groupEnd,
+                        const std::size_t valuesPerPoint,
+                        const OwnerPlan& ownerPlan);
+
+std::shared_ptr<monio::DataContainerBase> monio::AtlasWriter::createDataContainer(
+                                                                      const int dataType,
+                                                                      const std::string& name,
+                                                                      const std::size_t size) {
+  switch (dataType) {
+    case consts::eDataTypes::eDouble: {
+      std::shared_ptr<DataContainerDouble> dataContainerDouble =
+                        std::make_shared<DataContainerDouble>(name);
+      dataContainerDouble->setSize(size);
+      return dataContainerDouble;
+    }
+    case consts::eDataTypes::eFloat: {
+      std::shared_ptr<DataContainerFloat> dataContainerFloat =
+                        std::make_shared<DataContainerFloat>(name);
+      dataContainerFloat->setSize(size);
+      return dataContainerFloat;
+    }
+    case consts::eDataTypes::eInt: {
+      std::shared_ptr<DataContainerInt> dataContainerInt =
+                        std::make_shared<DataContainerInt>(name);
+      dataContainerInt->setSize(size);
+      return dataContainerInt;
+    }
+    default: {
+      Monio::get().closeFiles();
+      utils::throwException("AtlasWriter::createDataContainer()> Data type not coded for...");
+    }
+  }
+  return nullptr;
+}
+
+atlas::idx_t monio::AtlasWriter::getWriteLevels(const atlas::Field& field,
+                                                const std::string& writeName,
+                                                const bool noFirstLevel,
+                                                const bool isLfricConvention) {
+  oops::Log::debug() << "AtlasWriter::getWriteLevels()" << std::endl;
+  atlas::idx_t numLevels = field.shape(consts::eVertical);
+  if (isLfricConvention == true) {
+    // Erroneous case. For noFirstLevel == true field should have 70 levels
+    if (noFirstLevel == true && numLevels == consts::kVerticalFullSize) {
+      Monio::get().closeFiles();
+      utils::throwException("AtlasWriter::getWriteLevels()> Field levels misconfiguration...");
+    }
+    // WARNING - This name-check is an LFRic-Lite specific convention...
+    if (utils::findInVector(consts::kMissingVariableNames, writeName) == true) {
+      Monio::get().closeFiles();
+      utils::throwException("AtlasWriter::getWriteLevels()> Field write name misconfiguration...");
+    }
+    if (noFirstLevel == true && numLevels == consts::kVerticalHalfSize) {
+      return consts::kVerticalFullSize;
+    }
+  }
+  return numLevels;
+}
+
 atlas::Field monio::AtlasWriter::getWriteField(atlas::Field& field,
                                          const std::string& writeName,
                                          const bool noFirstLevel) {
@@ -341,7 +867,7 @@ atlas::Field monio::AtlasWriter::getWriteField(atlas::Field& field,
   if (utils::findInVector(consts::kMissingVariableNames, writeName) == false) {
     if (noFirstLevel == true && numLevels == consts::kVerticalHalfSize) {
       atlas::util::Config atlasOptions = atlas::option::name(writeName) |
-                                         atlas::option::global(0) |
+                                         atlas::option::global(mpiRankOwner_) |
                                          atlas::option::levels(consts::kVerticalFullSize);
       switch (atlasType.kind()) {
         case atlasType.KIND_REAL64: {
@@ -373,11 +899,14 @@ atlas::Field monio::AtlasWriter::copySurfaceLevel(const atlas::Field& inputField
   auto copiedFieldView = atlas::array::make_view<T, 2>(copiedField);
   auto inputFieldView = atlas::array::make_view<T, 2>(inputField);
   std::vector<atlas::idx_t> fieldShape = inputField.shape();
-  for (atlas::idx_t j = 0; j < fieldShape[consts::eVertical]; ++j) {
-    for (atlas::idx_t i = 0; i < fieldShape[consts::eHorizontal]; ++i) {
-      copiedFieldView(i, j + 1) = inputFieldView(i, j);
+  remap::forBlocks(fieldShape[consts::eVertical], remap::levelTile<T>(), &threadPool_,
+                   [&](const std::size_t levelStart, const std::size_t levelEnd) {
+    for (std::size_t j = levelStart; j < levelEnd; ++j) {
+      for (atlas::idx_t i = 0; i < fieldShape[consts::eHorizontal]; ++i) {
+        copiedFieldView(i, j + 1) = inputFieldView(i, j);
+      }
     }
-  }
+  });
   // Copy surface level of input field
   for (atlas::idx_t i = 0; i < fieldShape[consts::eHorizontal]; ++i) {
     copiedFieldView(i, 0) = inputFieldView(i, 0);
@@ -403,6 +932,13 @@ void monio::AtlasWriter::addVariableDimensions(const atlas::Field& field,
   if (field.metadata().get<bool>("global") == false) {  // If so, get the 2D size of the Field
     fieldShape[consts::eHorizontal] = utilsatlas::getHorizontalSize(field);
   }
+  addVariableDimensions(fieldShape, metadata, var, vertConfigName);
+}
+
+void monio::AtlasWriter::addVariableDimensions(std::vector<atlas::idx_t> fieldShape,
+                                               const Metadata& metadata,
+                                                     std::shared_ptr<monio::Variable> var,
+                                               const std::string& vertConfigName) {
   // Reversal of dims required for LFRic files. Currently applied to all output files.
   std::reverse(fieldShape.begin(), fieldShape.end());
   for (auto& dimSize : fieldShape) {
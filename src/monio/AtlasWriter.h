@@ -8,13 +8,17 @@
 ******************************************************************************/
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "Constants.h"
+#include "DistributionPlan.h"
 #include "FileData.h"
+#include "OwnerPlan.h"
+#include "ThreadPool.h"
 
 #include "atlas/array/DataType.h"
 #include "atlas/field.h"
@@ -28,8 +32,11 @@ namespace monio {
   ///        populate data containers with data in Atlas fields.
 class AtlasWriter {
  public:
+  /// \brief The threads of the given pool remap written data on the owner PE. The pool is owned
+  ///        by Monio, and outlives the writer.
   AtlasWriter(const eckit::mpi::Comm& mpiCommunicator,
-              const int mpiRankOwner);
+              const int mpiRankOwner,
+                    ThreadPool& threadPool);
 
   AtlasWriter()                               = delete;  //!< Deleted default constructor
   AtlasWriter(AtlasWriter&&)                  = delete;  //!< Deleted move constructor
@@ -37,6 +44,10 @@ class AtlasWriter {
   AtlasWriter& operator=( AtlasWriter&&)      = delete;  //!< Deleted move assignment
   AtlasWriter& operator=(const AtlasWriter&)  = delete;  //!< Deleted copy assignment
 
+  /// \brief Sets the PE rank that handles I/O. Where there are multiple owner PEs, each owner PE
+  ///        sets its own rank.
+  void setMpiRankOwner(const int mpiRankOwner);
+
   /// \brief Creates required metadata and data from at Atlas field. For writing LFRic data with
   ///        some existing metadata.
   void populateFileDataWithField(FileData& fileData,
@@ -52,27 +63,103 @@ class AtlasWriter {
                            const atlas::Field& field,
                            const std::string& writeName);
 
+  /// \brief Creates required metadata for a decomposed field, without gathering its data. For
+  ///        parallel writing of LFRic data with some existing metadata.
+  void populateMetadataWithLocalField(Metadata& metadata,
+                                const atlas::Field& field,
+                                const consts::FieldMetadata& fieldMetadata,
+                                const std::string& writeName,
+                                const std::string& vertConfigName,
+                                const bool isLfricConvention);
+
+  /// \brief Populates a data container with this PE's block of a decomposed field in LFRic order,
+  ///        by redistributing the locally-owned points of all PEs. Called by all PEs.
+  void populateBlockDataWithField(std::shared_ptr<monio::DataContainerBase>& dataContainer,
+                            const atlas::Field& field,
+                            const consts::FieldMetadata& fieldMetadata,
+                            const std::string& writeName,
+                            const bool isLfricConvention,
+                            const DistributionPlan& distributionPlan);
+
+  /// \brief Creates required metadata and data in LFRic order for a batch of decomposed fields,
+  ///        gathered to the plan's owner PE. The points of each PE are placed at their positions
+  ///        in file order as they arrive. Called by all PEs.
+  void populateFileDataWithLocalFields(FileData& fileData,
+                                 const std::vector<atlas::Field>& fields,
+                                 const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                 const std::vector<std::string>& writeNames,
+                                 const std::vector<std::string>& vertConfigNames,
+                                 const bool isLfricConvention,
+                                 const OwnerPlan& ownerPlan);
+
+  /// \brief Creates required metadata and data in LFRic order for a batch of fields, from the data
+  ///        of each PE's locally-owned points, gathered to the plan's owner PE. Data are sent in
+  ///        their file's type. Each group of fields of one type is packed by packData into a data
+  ///        container of that type, field-by-field, then point-by-point with levels innermost. For
+  ///        owner PEs without fields, e.g. I/O server PEs, packData adds nothing. Called by all
+  ///        PEs.
+  void populateFileDataWithLocalData(FileData& fileData,
+                    const std::function<void(const std::size_t groupStart,
+                                             const std::size_t groupEnd,
+                          const std::shared_ptr<DataContainerBase>& localData)>& packData,
+                               const std::vector<int>& dataTypes,
+                               const std::vector<atlas::idx_t>& writeLevels,
+                               const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                               const std::vector<std::string>& writeNames,
+                               const std::vector<std::string>& vertConfigNames,
+                               const bool isLfricConvention,
+                               const OwnerPlan& ownerPlan);
+
+  /// \brief Populates a data container in LFRic order with a slab of the written levels of a
+  ///        decomposed field, gathered to the plan's owner PE. Where more levels are written than
+  ///        the field has, its surface level is copied. The container holds the given file data
+  ///        type (see utilsatlas::getFileDataType). Called by all PEs.
+  void populateDataContainerWithLocalField(std::shared_ptr<monio::DataContainerBase>& dataContainer,
+                                     const atlas::Field& field,
+                                     const int fileDataType,
+                                     const std::string& writeName,
+                                     const atlas::idx_t writeLevels,
+                                     const std::size_t levelStart,
+                                     const std::size_t numLevels,
+                                     const OwnerPlan& ownerPlan);
+
+  /// \brief Returns the number of levels written for a field, after checking its configuration.
+  atlas::idx_t getWriteLevels(const atlas::Field& field,
+                              const std::string& writeName,
+                              const bool noFirstLevel,
+                              const bool isLfricConvention);
+
  private:
-  /// \brief Creates additionally required metadata for field. Called from populateFileDataWithField
-  ///        where LFRic metadata are provided.
+  /// \brief Creates additionally required metadata for field, written with a given type. Called
+  ///        from populateFileDataWithField where LFRic metadata are provided.
   void populateMetadataWithField(Metadata& metadata,
+                           const int type,
                            const atlas::Field& field,
                            const consts::FieldMetadata& fieldMetadata,
                            const std::string& varName,
                            const std::string& vertConfigName);
 
+  /// \brief Creates additionally required metadata for a variable of a given type and shape.
+  void populateMetadataWithField(Metadata& metadata,
+                           const int type,
+                           const std::vector<atlas::idx_t>& fieldShape,
+                           const consts::FieldMetadata& fieldMetadata,
+                           const std::string& varName,
+                           const std::string& vertConfigName);
+
   /// \brief Creates all metadata for field. Called from populateFileDataWithField where metadata
   ///        are created.
   void populateMetadataWithField(Metadata& metadata,
                            const atlas::Field& field,
                            const std::string& varName);
 
-  /// \brief Adds populated data container to instance of data. Called from
+  /// \brief Adds populated data container of the file data type to instance of data. Called from
   ///        populateFileDataWithField where LFRic metadata are provided.
   void populateDataWithField(Data& data,
                        const atlas::Field& field,
                        const std::vector<size_t>& lfricToAtlasMap,
-                       const std::string& fieldName);
+                       const std::string& fieldName,
+                       const int fileDataType);
 
   /// \brief Adds populated data container to instance of data. Called from
   ///        populateFileDataWithField where metadata are created.
@@ -80,12 +167,13 @@ class AtlasWriter {
                        const atlas::Field& field,
                        const std::vector<atlas::idx_t>& dimensions);
 
-  /// \brief Derives the container type and makes the call to populate it. Used where metadata are
-  ///        provided and data are written in LFRic order.
+  /// \brief Creates a container of the file data type and makes the call to populate it. Used where
+  ///        metadata are provided and data are written in LFRic order.
   void populateDataContainerWithField(std::shared_ptr<monio::DataContainerBase>& dataContainer,
                                 const atlas::Field& field,
                                 const std::vector<size_t>& lfricToAtlasMap,
-                                const std::string& fieldName);
+                                const std::string& fieldName,
+                                const int fileDataType);
 
   /// \brief Derives the container type and makes the call to populate it. Used where metadata are
   ///        created as part of the writing process and data are written in Atlas order.
@@ -94,15 +182,85 @@ class AtlasWriter {
                                 const std::vector<int>& dimensions);
 
   /// \brief Iterates through field and populates vector with data from field in LFRic order.
+  ///        Data are converted where the field's type differs from the vector's.
   template<typename T> void populateDataVec(std::vector<T>& dataVec,
                                       const atlas::Field& field,
                                       const std::vector<size_t>& lfricToAtlasMap);
 
+  /// \brief Remaps data of a field of type FieldT into a vector of type FileT, converting each
+  ///        value as it is copied. Integer data are only written from integer fields.
+  template<typename FieldT, typename FileT>
+  void remapFromField(std::vector<FileT>& dataVec,
+                      const atlas::Field& field,
+                      const std::vector<size_t>& lfricToAtlasMap);
+
   /// \brief Iterates through field and populates vector with data from field in Atlas order.
   template<typename T> void populateDataVec(std::vector<T>& dataVec,
                                       const atlas::Field& field,
                                       const std::vector<atlas::idx_t>& dimensions);
 
+  /// \brief Redistributes locally-owned data to populate a vector with this PE's block. Where
+  ///        more levels are written than the field has, its surface level is copied.
+  template<typename T> void populateBlockDataVec(std::vector<T>& blockVec,
+                                           const atlas::Field& field,
+                                           const atlas::idx_t writeLevels,
+                                           const DistributionPlan& distributionPlan);
+
+  /// \brief Derives the type of a local data container and appends a range of the written levels
+  ///        of the locally-owned points of a field to it.
+  void packDataContainer(const std::shared_ptr<DataContainerBase>& localData,
+                         const atlas::Field& field,
+                         const atlas::idx_t writeLevels,
+                         const std::size_t levelStart,
+                         const std::size_t numLevels,
+                         const OwnerPlan& ownerPlan);
+
+  /// \brief Appends a range of the written levels of the locally-owned points of a field to a
+  ///        buffer, point-by-point with levels innermost. Where more levels are written than the
+  ///        field has, its surface level is copied. Data are converted where the field's type
+  ///        differs from the buffer's.
+  template<typename T> void packLocalField(std::vector<T>& localData,
+                                     const atlas::Field& field,
+                                     const atlas::idx_t writeLevels,
+                                     const std::size_t levelStart,
+                                     const std::size_t numLevels,
+                                     const OwnerPlan& ownerPlan);
+
+  /// \brief Appends levels of a field of type FieldT to a buffer of type FileT, converting each
+  ///        value as it is copied. Integer data are only written from integer fields.
+  template<typename FieldT, typename FileT>
+  void packFromField(std::vector<FileT>& localData,
+                     const atlas::Field& field,
+                     const atlas::idx_t writeLevels,
+                     const std::size_t levelStart,
+                     const std::size_t numLevels,
+                     const OwnerPlan& ownerPlan);
+
+  /// \brief Derives the type of a group of packed local data and gathers them to the plan's owner
+  ///        PE, into the group's data containers in file order.
+  void gatherDataContainer(const std::shared_ptr<DataContainerBase>& localData,
+                     const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                     const std::vector<atlas::idx_t>& numLevels,
+                     const std::size_t groupStart,
+                     const std::size_t groupEnd,
+                     const std::size_t valuesPerPoint,
+                     const OwnerPlan& ownerPlan);
+
+  /// \brief Gathers a group of packed local data to the plan's owner PE, and places each PE's data
+  ///        in file order in the group's data containers, of type ContainerT, as they arrive.
+  template<typename ContainerT, typename T> void gatherFileData(const std::vector<T>& localData,
+                     const std::vector<std::shared_ptr<DataContainerBase>>& dataContainers,
+                     const std::vector<atlas::idx_t>& numLevels,
+                     const std::size_t groupStart,
+                     const std::size_t groupEnd,
+                     const std::size_t valuesPerPoint,
+                     const OwnerPlan& ownerPlan);
+
+  /// \brief Returns an empty data container of a given type and size.
+  std::shared_ptr<monio::DataContainerBase> createDataContainer(const int dataType,
+                                                          const std::string& name,
+                                                          const std::size_t size);
+
   /// \brief  Map JEDI fields back into LFRic function space.
   atlas::Field getWriteField(atlas::Field& inputField,
                        const std::string& writeName,
@@ -121,10 +279,17 @@ class AtlasWriter {
                                    std::shared_ptr<monio::Variable> var,
                              const std::string& vertConfigName = "");
 
+  /// \brief Associates a given variable with the dimensions of a given (global) shape.
+  void addVariableDimensions(std::vector<atlas::idx_t> fieldShape,
+                             const Metadata& metadata,
+                                   std::shared_ptr<monio::Variable> var,
+                             const std::string& vertConfigName = "");
+
   void addGlobalAttributes(Metadata& metadata, const bool isLfricConvention = true);
 
   const eckit::mpi::Comm& mpiCommunicator_;
-  const std::size_t mpiRankOwner_;
+  std::size_t mpiRankOwner_;
+  ThreadPool& threadPool_;
 
   /// \brief Used for automatic creation of dimension names for fields where metadata are created.
   int dimCount_ = 0;
@@ -29,6 +29,9 @@ struct FieldMetadata {
   std::string units;
   int numberOfLevels;
   bool noFirstLevel;
+  /// \brief Data type written to file, from eDataTypes, where it differs from that of the field,
+  ///        e.g. eFloat for a double-precision field. The default of -1 writes the field's type.
+  int fileDataType = -1;
 };
 
 /// Enums //////////////////////////////////////////////////////////////////////////////////////////
@@ -42,7 +45,8 @@ enum eFieldMetadata {
   eJediVertConfig,
   eUnits,
   eNumberOfLevels,
-  eNoFirstLevel
+  eNoFirstLevel,
+  eFileDataType
 };
 
 /// \brief For indexing spatial coordinates and associated data structures, e.g. kLfricCoordVarNames
@@ -63,6 +67,27 @@ enum eVariableConventions {
   eJediConvention
 };
 
+/// \brief For selecting how data are read by the Monio read functions. Indexes kReadModeNames.
+enum eReadModes {
+  eSerialRead,
+  eParallelRead
+};
+
+/// \brief For selecting how data are written by the Monio write functions. Indexes kWriteModeNames.
+enum eWriteModes {
+  eSerialWrite,
+  eParallelWrite,
+  eAsyncWrite
+};
+
+/// \brief For identifying the requests made by compute PEs to I/O server PEs.
+enum eIoServerRequests {
+  eInitialiseRequest,
+  eReadRequest,
+  eWriteRequest,
+  eStopRequest
+};
+
 /// \brief Used for populating output files with the correct metadata associated with variable data.
 enum eAttributeNames {
   eStandardName,
@@ -124,6 +149,10 @@ const std::string_view kProducedByName = "produced_by";
 const std::string_view kProducedByString = "MONIO: Met Office NetCDF I/O";
 const std::string_view kVariableConventionName = "variable_convention";
 
+const std::string_view kComputeCommName = "monio_compute";
+const std::string_view kIoServersCommName = "monio_io_servers";
+const std::string_view kIoServerCommName = "monio_io_server_";  // Suffixed by the I/O server index
+
 /// Multi-dimensional String/Views /////////////////////////////////////////////////////////////////
 
 /// \brief Used with eDataTypes, above, for writing metadata to file or console.
@@ -175,6 +204,19 @@ const std::vector<std::string> kNamingConventions({
   "JEDI"
 });
 
+/// \brief Paired with eReadModes, above. For selecting read modes by name, e.g. in configuration.
+const std::vector<std::string> kReadModeNames({
+  "serial",
+  "parallel"
+});
+
+/// \brief Paired with eWriteModes, above. For selecting write modes by name, e.g. in configuration.
+const std::vector<std::string> kWriteModeNames({
+  "serial",
+  "parallel",
+  "async"
+});
+
 const std::vector<std::string> kMissingVariableNames({
   "TO BE DERIVED",      // LFRic-Lite - variables without names in the LFRic context
   "TO BE IMPLEMENTED",  // LFRic-Lite - theoretical variables that aren't used
@@ -190,6 +232,8 @@ const std::vector<std::string> kCoordVarNames = {std::string(kLongitudeVarName),
 
 const int kMPIRankOwner = 0;
 
+const std::size_t kGatherBatchSize = 8;  // Maximum number of fields gathered per owner PE at once
+
 const int kVerticalFullSize = 71;
 const int kVerticalHalfSize = 70;
 const int kVertFullNoSurfSize = 70;
@@ -0,0 +1,215 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "DistributionPlan.h"
+
+#include <algorithm>
+
+#include "oops/util/Logger.h"
+
+#include "Utils.h"
+
+namespace {
+std::vector<int> getDisplacements(const std::vector<int>& counts, const int numLevels) {
+  std::vector<int> displacements(counts.size(), 0);
+  for (std::size_t i = 1; i < counts.size(); ++i) {
+    displacements[i] = displacements[i - 1] + (counts[i - 1] * numLevels);
+  }
+  return displacements;
+}
+
+std::vector<int> getScaledCounts(const std::vector<int>& counts, const int numLevels) {
+  std::vector<int> scaledCounts(counts.size());
+  std::transform(counts.begin(), counts.end(), scaledCounts.begin(),
+                 [numLevels](const int count) { return count * numLevels; });
+  return scaledCounts;
+}
+}  // anonymous namespace
+
+monio::DistributionPlan::DistributionPlan(const eckit::mpi::Comm& mpiCommunicator,
+                                          const std::vector<size_t>& localFileIndices,
+                                          const size_t globalSize) :
+    mpiCommunicator_(mpiCommunicator),
+    globalSize_(globalSize),
+    localSize_(localFileIndices.size()) {
+  oops::Log::debug() << "DistributionPlan::DistributionPlan()" << std::endl;
+  std::size_t numRanks = mpiCommunicator_.size();
+  blockStarts_.resize(numRanks + 1);
+  for (std::size_t rank = 0; rank <= numRanks; ++rank) {
+    blockStarts_[rank] = (rank * globalSize_) / numRanks;
+  }
+  createPlan(localFileIndices);
+}
+
+size_t monio::DistributionPlan::getGlobalSize() const {
+  return globalSize_;
+}
+
+size_t monio::DistributionPlan::getLocalSize() const {
+  return localSize_;
+}
+
+size_t monio::DistributionPlan::getBlockStart() const {
+  return blockStarts_[mpiCommunicator_.rank()];
+}
+
+size_t monio::DistributionPlan::getBlockSize() const {
+  return blockStarts_[mpiCommunicator_.rank() + 1] - blockStarts_[mpiCommunicator_.rank()];
+}
+
+template<typename T, typename LocalT>
+void monio::DistributionPlan::blockToLocal(const std::vector<T>& blockData,
+                                           const size_t numLevels,
+                                                 LocalT* localData,
+                                           const size_t localStride) const {
+  oops::Log::debug() << "DistributionPlan::blockToLocal()" << std::endl;
+  std::size_t blockSize = getBlockSize();
+  if (blockData.size() != blockSize * numLevels) {
+    utils::throwException("DistributionPlan::blockToLocal()> "
+                          "Block data are not configured for the expected levels...");
+  }
+  // Pack block data in the order requested by each owner, point-by-point
+  std::vector<T> sendBuffer(blockOrder_.size() * numLevels);
+  for (std::size_t i = 0; i < blockOrder_.size(); ++i) {
+    for (std::size_t j = 0; j < numLevels; ++j) {
+      sendBuffer[(i * numLevels) + j] = blockData[blockOrder_[i] + (j * blockSize)];
+    }
+  }
+  std::vector<int> sendCounts = getScaledCounts(blockCounts_, numLevels);
+  std::vector<int> sendDispls = getDisplacements(blockCounts_, numLevels);
+  std::vector<int> recvCounts = getScaledCounts(localCounts_, numLevels);
+  std::vector<int> recvDispls = getDisplacements(localCounts_, numLevels);
+  std::vector<T> recvBuffer(localOrder_.size() * numLevels);
+  mpiCommunicator_.allToAllv(sendBuffer.data(), sendCounts.data(), sendDispls.data(),
+                             recvBuffer.data(), recvCounts.data(), recvDispls.data());
+  // Unpack into locally-owned order, directly in local storage
+  for (std::size_t i = 0; i < localOrder_.size(); ++i) {
+    const T* recvPointData = recvBuffer.data() + (i * numLevels);
+    LocalT* localPointData = localData + (localOrder_[i] * localStride);
+    for (std::size_t j = 0; j < numLevels; ++j) {
+      localPointData[j] = static_cast<LocalT>(recvPointData[j]);
+    }
+  }
+}
+
+template void monio::DistributionPlan::blockToLocal<double, double>(
+                                                        const std::vector<double>& blockData,
+                                                        const size_t numLevels,
+                                                              double* localData,
+                                                        const size_t localStride) const;
+template void monio::DistributionPlan::blockToLocal<float, float>(
+                                                        const std::vector<float>& blockData,
+                                                        const size_t numLevels,
+                                                              float* localData,
+                                                        const size_t localStride) const;
+template void monio::DistributionPlan::blockToLocal<int, int>(
+                                                        const std::vector<int>& blockData,
+                                                        const size_t numLevels,
+                                                              int* localData,
+                                                        const size_t localStride) const;
+template void monio::DistributionPlan::blockToLocal<float, double>(
+                                                        const std::vector<float>& blockData,
+                                                        const size_t numLevels,
+                                                              double* localData,
+                                                        const size_t localStride) const;
+template void monio::DistributionPlan::blockToLocal<int, double>(
+                                                        const std::vector<int>& blockData,
+                                                        const size_t numLevels,
+                                                              double* localData,
+                                                        const size_t localStride) const;
+template void monio::DistributionPlan::blockToLocal<double, float>(
+                                                        const std::vector<double>& blockData,
+                                                        const size_t numLevels,
+                                                              float* localData,
+                                                        const size_t localStride) const;
+template void monio::DistributionPlan::blockToLocal<int, float>(
+                                                        const std::vector<int>& blockData,
+                                                        const size_t numLevels,
+                                                              float* localData,
+                                                        const size_t localStride) const;
+
+template<typename T>
+void monio::DistributionPlan::localToBlock(const std::vector<T>& localData,
+                                           const size_t numLevels,
+                                                 std::vector<T>& blockData) const {
+  oops::Log::debug() << "DistributionPlan::localToBlock()" << std::endl;
+  if (localData.size() != localSize_ * numLevels) {
+    utils::throwException("DistributionPlan::localToBlock()> "
+                          "Local data are not configured for the expected levels...");
+  }
+  // Pack local data in the order of the PEs whose blocks hold them
+  std::vector<T> sendBuffer(localOrder_.size() * numLevels);
+  for (std::size_t i = 0; i < localOrder_.size(); ++i) {
+    std::copy_n(localData.begin() + (localOrder_[i] * numLevels), numLevels,
+                sendBuffer.begin() + (i * numLevels));
+  }
+  std::vector<int> sendCounts = getScaledCounts(localCounts_, numLevels);
+  std::vector<int> sendDispls = getDisplacements(localCounts_, numLevels);
+  std::vector<int> recvCounts = getScaledCounts(blockCounts_, numLevels);
+  std::vector<int> recvDispls = getDisplacements(blockCounts_, numLevels);
+  std::vector<T> recvBuffer(blockOrder_.size() * numLevels);
+  mpiCommunicator_.allToAllv(sendBuffer.data(), sendCounts.data(), sendDispls.data(),
+                             recvBuffer.data(), recvCounts.data(), recvDispls.data());
+  // Unpack into block order, level-by-level
+  std::size_t blockSize = getBlockSize();
+  blockData.resize(blockSize * numLevels);
+  for (std::size_t i = 0; i < blockOrder_.size(); ++i) {
+    for (std::size_t j = 0; j < numLevels; ++j) {
+      blockData[blockOrder_[i] + (j * blockSize)] = recvBuffer[(i * numLevels) + j];
+    }
+  }
+}
+
+template void monio::DistributionPlan::localToBlock<double>(const std::vector<double>& localData,
+                                                     const size_t numLevels,
+                                                           std::vector<double>& blockData) const;
+template void monio::DistributionPlan::localToBlock<float>(const std::vector<float>& localData,
+                                                     const size_t numLevels,
+                                                           std::vector<float>& blockData) const;
+template void monio::DistributionPlan::localToBlock<int>(const std::vector<int>& localData,
+                                                     const size_t numLevels,
+                                                           std::vector<int>& blockData) const;
+
+void monio::DistributionPlan::createPlan(const std::vector<size_t>& localFileIndices) {
+  oops::Log::debug() << "DistributionPlan::createPlan()" << std::endl;
+  std::size_t numRanks = mpiCommunicator_.size();
+  // Find the PE whose block holds each locally-owned point
+  std::vector<std::size_t> blockRanks(localSize_);
+  localCounts_.assign(numRanks, 0);
+  for (std::size_t i = 0; i < localSize_; ++i) {
+    if (localFileIndices[i] >= globalSize_) {
+      utils::throwException("DistributionPlan::createPlan()> "
+                            "File index exceeds the global size of the data...");
+    }
+    auto it = std::upper_bound(blockStarts_.begin(), blockStarts_.end(), localFileIndices[i]);
+    blockRanks[i] = std::distance(blockStarts_.begin(), it) - 1;
+    localCounts_[blockRanks[i]]++;
+  }
+  // Group local points by block PE, preserving their relative order
+  std::vector<int> offsets = getDisplacements(localCounts_, 1);
+  localOrder_.resize(localSize_);
+  std::vector<size_t> requestedIndices(localSize_);
+  for (std::size_t i = 0; i < localSize_; ++i) {
+    int pos = offsets[blockRanks[i]]++;
+    localOrder_[pos] = i;
+    requestedIndices[pos] = localFileIndices[i];
+  }
+  // Tell each block PE which of its points are owned here
+  blockCounts_.assign(numRanks, 0);
+  mpiCommunicator_.allToAll(localCounts_, blockCounts_);
+  std::vector<int> localDispls = getDisplacements(localCounts_, 1);
+  std::vector<int> blockDispls = getDisplacements(blockCounts_, 1);
+  std::size_t numBlockPoints = blockDispls.back() + blockCounts_.back();
+  blockOrder_.resize(numBlockPoints);
+  mpiCommunicator_.allToAllv(requestedIndices.data(), localCounts_.data(), localDispls.data(),
+                             blockOrder_.data(), blockCounts_.data(), blockDispls.data());
+  std::size_t blockStart = getBlockStart();
+  for (auto& blockIndex : blockOrder_) {
+    blockIndex -= blockStart;
+  }
+}
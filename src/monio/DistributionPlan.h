@@ -0,0 +1,74 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <vector>
+
+#include "eckit/mpi/Comm.h"
+
+namespace monio {
+/// \brief Describes the exchange of horizontal points between the PEs that own them in a decomposed
+///        field, and the PEs that hold contiguous blocks of the same points in file order. Used for
+///        parallel reading and writing, where each PE accesses only its own block of the file.
+class DistributionPlan {
+ public:
+  /// \brief Creates a plan where the file's horizontal points are split into even, contiguous
+  ///        blocks across all PEs. A collective call.
+  DistributionPlan(const eckit::mpi::Comm& mpiCommunicator,
+                   const std::vector<size_t>& localFileIndices,
+                   const size_t globalSize);
+
+  DistributionPlan()                                   = delete;  //!< Deleted default constructor
+  DistributionPlan(DistributionPlan&&)                 = delete;  //!< Deleted move constructor
+  DistributionPlan(const DistributionPlan&)            = delete;  //!< Deleted copy constructor
+  DistributionPlan& operator=(DistributionPlan&&)      = delete;  //!< Deleted move assignment
+  DistributionPlan& operator=(const DistributionPlan&) = delete;  //!< Deleted copy assignment
+
+  size_t getGlobalSize() const;
+  size_t getLocalSize() const;
+  size_t getBlockStart() const;
+  size_t getBlockSize() const;
+
+  /// \brief Sends data held in this PE's block to the PEs that own them. A collective call. Block
+  ///        data are ordered level-by-level, as in the file. Received data are placed directly in
+  ///        local storage, e.g. that of an Atlas field, with levels innermost and the given stride
+  ///        between points, and converted to its type as they are placed.
+  template<typename T, typename LocalT> void blockToLocal(const std::vector<T>& blockData,
+                                                          const size_t numLevels,
+                                                                LocalT* localData,
+                                                          const size_t localStride) const;
+
+  /// \brief Sends locally-owned data to the PEs holding their blocks. The reverse of blockToLocal.
+  template<typename T> void localToBlock(const std::vector<T>& localData,
+                                         const size_t numLevels,
+                                               std::vector<T>& blockData) const;
+
+ private:
+  /// \brief Exchanges the file indices of locally-owned points so that each PE knows which points
+  ///        of its block are owned by which PE.
+  void createPlan(const std::vector<size_t>& localFileIndices);
+
+  const eckit::mpi::Comm& mpiCommunicator_;
+  const size_t globalSize_;
+  const size_t localSize_;
+
+  /// \brief Position of the first point of each PE's block, with a final entry of globalSize_.
+  std::vector<size_t> blockStarts_;
+
+  /// \brief Number of locally-owned points held in the block of each PE.
+  std::vector<int> localCounts_;
+  /// \brief Locally-owned point positions, grouped by the PE whose block holds them.
+  std::vector<size_t> localOrder_;
+
+  /// \brief Number of points in this PE's block owned by each PE.
+  std::vector<int> blockCounts_;
+  /// \brief Positions within this PE's block, grouped by the PE that owns them.
+  std::vector<size_t> blockOrder_;
+};
+}  // namespace monio
@@ -9,6 +9,8 @@
 ******************************************************************************/
 #include "File.h"
 
+#include <netcdf_par.h>
+
 #include <map>
 #include <memory>
 #include <stdexcept>
@@ -23,6 +25,43 @@
 #include "Utils.h"
 #include "Variable.h"
 
+namespace {
+/// \brief Extends the C++ NetCDF file class, which offers no parallel access, by opening the file
+///        with the NetCDF C library's parallel functions. File modes map to the same flags as the
+///        C++ class uses for serial access.
+class ParallelNcFile : public netCDF::NcFile {
+ public:
+  ParallelNcFile(const std::string& filePath,
+                 const netCDF::NcFile::FileMode fileMode,
+                 const eckit::mpi::Comm& mpiCommunicator) {
+    MPI_Comm mpiComm = MPI_Comm_f2c(mpiCommunicator.communicator());
+    switch (fileMode) {
+      case netCDF::NcFile::read: {
+        netCDF::ncCheck(nc_open_par(filePath.c_str(), NC_NOWRITE, mpiComm, MPI_INFO_NULL, &myId),
+                        __FILE__, __LINE__);
+        break;
+      }
+      case netCDF::NcFile::write: {
+        netCDF::ncCheck(nc_open_par(filePath.c_str(), NC_WRITE, mpiComm, MPI_INFO_NULL, &myId),
+                        __FILE__, __LINE__);
+        break;
+      }
+      case netCDF::NcFile::replace: {
+        netCDF::ncCheck(nc_create_par(filePath.c_str(), NC_NETCDF4 | NC_CLOBBER, mpiComm,
+                                      MPI_INFO_NULL, &myId), __FILE__, __LINE__);
+        break;
+      }
+      case netCDF::NcFile::newFile: {
+        netCDF::ncCheck(nc_create_par(filePath.c_str(), NC_NETCDF4 | NC_NOCLOBBER, mpiComm,
+                                      MPI_INFO_NULL, &myId), __FILE__, __LINE__);
+        break;
+      }
+    }
+    nullObject = false;
+  }
+};
+}  // anonymous namespace
+
 // De/Constructors /////////////////////////////////////////////////////////////////////////////////
 
 monio::File::File(const std::string& filePath,
@@ -41,6 +80,23 @@ monio::File::File(const std::string& filePath,
   }
 }
 
+monio::File::File(const std::string& filePath,
+                  const netCDF::NcFile::FileMode fileMode,
+                  const eckit::mpi::Comm& mpiCommunicator):
+                  filePath_(filePath),
+                  fileMode_(fileMode),
+                  isParallel_(true) {
+  try {
+    oops::Log::debug() << "File::File(): filePath_> " <<  filePath_  <<
+                         ", fileMode_> " << fileMode_ << ", parallel" << std::endl;
+    dataFile_ = std::make_unique<ParallelNcFile>(filePath_, fileMode_, mpiCommunicator);
+  } catch (netCDF::exceptions::NcException& exception) {
+    std::string message = "An exception occurred in File> ";
+    message.append(exception.what());
+    utils::throwException(message);
+  }
+}
+
 monio::File::~File() {
   oops::Log::debug() << "File::~File() ";
   close();
@@ -56,6 +112,14 @@ void monio::File::close() {
   getFile().close();
   dataFile_.release();
 }
+
+bool monio::File::isParallel() {
+  return isParallel_;
+}
+
+const std::string& monio::File::getPath() const {
+  return filePath_;
+}
 // Reading functions ///////////////////////////////////////////////////////////////////////////////
 
 void monio::File::readMetadata(Metadata& metadata) {
@@ -287,6 +351,10 @@ void monio::File::readFieldDatum(const std::string& fieldName,
   oops::Log::debug() << "File::readFieldDatum()" << std::endl;
   if (fileMode_ == netCDF::NcFile::read) {
     auto var = getFile().getVar(fieldName);
+    if (isParallel_ == true) {
+      netCDF::ncCheck(nc_var_par_access(getFile().getId(), var.getId(), NC_COLLECTIVE),
+                      __FILE__, __LINE__);
+    }
     var.getVar(startVec, countVec, dataVec.data());
   } else {
     close();
@@ -454,8 +522,50 @@ template void monio::File::writeSingleDatum<float>(const std::string& varName,
 template void monio::File::writeSingleDatum<int>(const std::string& varName,
                                                  const std::vector<int>& dataVec);
 
+template<typename T>
+void monio::File::writeFieldDatum(const std::string& fieldName,
+                                  const std::vector<size_t>& startVec,
+                                  const std::vector<size_t>& countVec,
+                                  const std::vector<T>& dataVec) {
+  oops::Log::debug() << "File::writeFieldDatum()" << std::endl;
+  if (fileMode_ != netCDF::NcFile::read) {
+    auto var = getFile().getVar(fieldName);
+    if (isParallel_ == true) {
+      netCDF::ncCheck(nc_var_par_access(getFile().getId(), var.getId(), NC_COLLECTIVE),
+                      __FILE__, __LINE__);
+    }
+    var.putVar(startVec, countVec, dataVec.data());
+  } else {
+    close();
+    utils::throwException("File::writeFieldDatum()> Read file accessed for writing...");
+  }
+}
+
+template void monio::File::writeFieldDatum<double>(const std::string& varName,
+                                                   const std::vector<size_t>& startVec,
+                                                   const std::vector<size_t>& countVec,
+                                                   const std::vector<double>& dataVec);
+template void monio::File::writeFieldDatum<float>(const std::string& varName,
+                                                  const std::vector<size_t>& startVec,
+                                                  const std::vector<size_t>& countVec,
+                                                  const std::vector<float>& dataVec);
+template void monio::File::writeFieldDatum<int>(const std::string& varName,
+                                                const std::vector<size_t>& startVec,
+                                                const std::vector<size_t>& countVec,
+                                                const std::vector<int>& dataVec);
+
 // Other functions /////////////////////////////////////////////////////////////////////////////////
 
+std::vector<std::pair<std::string, size_t>> monio::File::getVarDimensions(
+                                                                  const std::string& varName) {
+  oops::Log::debug() << "File::getVarDimensions()" << std::endl;
+  std::vector<std::pair<std::string, size_t>> varDimensions;
+  for (const auto& ncDim : getFile().getVar(varName).getDims()) {
+    varDimensions.push_back(std::make_pair(ncDim.getName(), ncDim.getSize()));
+  }
+  return varDimensions;
+}
+
 netCDF::NcFile& monio::File::getFile() {
   if (dataFile_ == nullptr) {
     utils::throwException("File::getFile()> Data file has not been initialised...");
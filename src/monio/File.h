@@ -12,8 +12,11 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "eckit/mpi/Comm.h"
+
 #include "Metadata.h"
 
 namespace monio {
@@ -21,6 +24,11 @@ namespace monio {
 class File {
  public:
   File(const std::string& filePath, const netCDF::NcFile::FileMode fileMode);
+  /// \brief Opens a file for collective access by all PEs of the communicator via HDF5/MPI-IO.
+  ///        Requires a NetCDF-4 file and a NetCDF library built with parallel support.
+  File(const std::string& filePath,
+       const netCDF::NcFile::FileMode fileMode,
+       const eckit::mpi::Comm& mpiCommunicator);
   ~File();
 
   File()                       = delete;  //!< Deleted default constructor
@@ -30,6 +38,8 @@ class File {
   File& operator=(const File&) = delete;  //!< Deleted copy assignment
 
   void close();
+  bool isParallel();
+  const std::string& getPath() const;
   /// \brief Read all metadata.
   void readMetadata(Metadata& metadata);
   /// \brief Read dimensions, attributes, and a subset of variables metadata.
@@ -39,7 +49,8 @@ class File {
   /// \brief Read a complete variable.
   template<typename T> void readSingleDatum(const std::string& varName,
                                             std::vector<T>& dataVec);
-  /// \brief Read a subset of a variable. Usually at different positions in a time series.
+  /// \brief Read a subset of a variable. Usually at different positions in a time series. For files
+  ///        opened for parallel access this is a collective call.
   template<typename T> void readFieldDatum(const std::string& fieldName,
                                            const std::vector<size_t>& startVec,
                                            const std::vector<size_t>& countVec,
@@ -49,6 +60,15 @@ class File {
 
   template<typename T> void writeSingleDatum(const std::string& varName,
                                              const std::vector<T>& dataVec);
+  /// \brief Write a subset of a variable. For files opened for parallel access this is a collective
+  ///        call.
+  template<typename T> void writeFieldDatum(const std::string& fieldName,
+                                            const std::vector<size_t>& startVec,
+                                            const std::vector<size_t>& countVec,
+                                            const std::vector<T>& dataVec);
+
+  /// \brief Returns the names and sizes of a variable's dimensions, as defined in the file.
+  std::vector<std::pair<std::string, size_t>> getVarDimensions(const std::string& varName);
 
  private:
   netCDF::NcFile& getFile();
@@ -68,5 +88,6 @@ class File {
 
   std::string filePath_;
   netCDF::NcFile::FileMode fileMode_;
+  bool isParallel_ = false;
 };
 }  // namespace monio
@@ -0,0 +1,149 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "IoServer.h"
+
+#include <functional>
+#include <sstream>
+
+#include "oops/util/Logger.h"
+
+#include "Utils.h"
+
+namespace {
+const std::size_t kRequestLines = 8;  // Lines preceding those of the fields
+const std::size_t kFieldLines = monio::consts::eFileDataType + 5;  // Metadata, then four others
+
+std::string getServerCommName(const std::size_t serverIndex) {
+  return std::string(monio::consts::kIoServerCommName) + std::to_string(serverIndex);
+}
+}  // anonymous namespace
+
+monio::IoServer::IoServer(const eckit::mpi::Comm& mpiCommunicator,
+                          const int numServerRanks) :
+    numComputeRanks_(0),
+    numServers_(0),
+    isServer_(false),
+    serverIndex_(0) {
+  oops::Log::debug() << "IoServer::IoServer()" << std::endl;
+  if (numServerRanks < 1 || std::size_t(numServerRanks) >= mpiCommunicator.size()) {
+    utils::throwException("IoServer::IoServer()> Number of I/O server PEs must be at least one, "
+                          "and fewer than the number of PEs...");
+  }
+  numServers_ = numServerRanks;
+  numComputeRanks_ = mpiCommunicator.size() - numServers_;
+  isServer_ = mpiCommunicator.rank() >= numComputeRanks_;
+  if (isServer_ == true) {
+    serverIndex_ = mpiCommunicator.rank() - numComputeRanks_;
+  }
+  mpiCommunicator.split(isServer_ == true ? 1 : 0, getLocalCommName());
+  // Each I/O server shares a communicator with all compute PEs, where it has the highest rank
+  for (std::size_t server = 0; server < numServers_; ++server) {
+    int color = isServer_ == false || serverIndex_ == server ? 0 : 1;
+    mpiCommunicator.split(color, getServerCommName(server));
+  }
+}
+
+bool monio::IoServer::isServer() const {
+  return isServer_;
+}
+
+std::size_t monio::IoServer::getNumServers() const {
+  return numServers_;
+}
+
+std::string monio::IoServer::getLocalCommName() const {
+  return std::string(isServer_ == true ? consts::kIoServersCommName : consts::kComputeCommName);
+}
+
+int monio::IoServer::getMpiRankServer() const {
+  return numComputeRanks_;
+}
+
+const eckit::mpi::Comm& monio::IoServer::getServerComm(const std::string& filePath) const {
+  return getServerComm(std::hash<std::string>{}(filePath) % numServers_);
+}
+
+const eckit::mpi::Comm& monio::IoServer::getServerComm(const std::size_t serverIndex) const {
+  return eckit::mpi::comm(getServerCommName(serverIndex).c_str());
+}
+
+const eckit::mpi::Comm& monio::IoServer::getServerComm() const {
+  return getServerComm(serverIndex_);
+}
+
+void monio::IoServer::broadcastRequest(const eckit::mpi::Comm& serverComm,
+                                             IoRequest& request) const {
+  oops::Log::debug() << "IoServer::broadcastRequest()" << std::endl;
+  std::vector<char> buffer;
+  if (serverComm.rank() == 0) {
+    buffer = encodeRequest(request);
+  }
+  utils::broadcastVector(serverComm, buffer, 0);
+  if (serverComm.rank() != 0) {
+    request = decodeRequest(buffer);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<char> monio::IoServer::encodeRequest(const IoRequest& request) const {
+  std::ostringstream stream;
+  stream << request.type << "\n" << request.filePath << "\n" << request.gridName << "\n" <<
+            request.initFilePath << "\n" << request.dateTime << "\n" << request.isState << "\n" <<
+            request.isLfricConvention << "\n" << request.fieldMetadataVec.size() << "\n";
+  for (std::size_t i = 0; i < request.fieldMetadataVec.size(); ++i) {
+    const consts::FieldMetadata& fieldMetadata = request.fieldMetadataVec[i];
+    stream << fieldMetadata.lfricReadName << "\n" << fieldMetadata.lfricWriteName << "\n" <<
+              fieldMetadata.jediName << "\n" << fieldMetadata.lfricVertConfig << "\n" <<
+              fieldMetadata.jediVertConfig << "\n" << fieldMetadata.units << "\n" <<
+              fieldMetadata.numberOfLevels << "\n" << fieldMetadata.noFirstLevel << "\n" <<
+              fieldMetadata.fileDataType << "\n" << request.varNames[i] << "\n" <<
+              request.vertConfigNames[i] << "\n" << request.numLevels[i] << "\n" <<
+              request.dataTypes[i] << "\n";
+  }
+  std::string requestStr = stream.str();
+  return std::vector<char>(requestStr.begin(), requestStr.end());
+}
+
+monio::IoRequest monio::IoServer::decodeRequest(const std::vector<char>& buffer) const {
+  std::vector<std::string> lines = utils::strToWords(std::string(buffer.begin(), buffer.end()),
+                                                     '\n');
+  if (lines.size() < kRequestLines ||
+      lines.size() != kRequestLines + (std::stoul(lines[kRequestLines - 1]) * kFieldLines)) {
+    utils::throwException("IoServer::decodeRequest()> Request is incomplete...");
+  }
+  IoRequest request;
+  request.type = std::stoi(lines[0]);
+  request.filePath = lines[1];
+  request.gridName = lines[2];
+  request.initFilePath = lines[3];
+  request.dateTime = lines[4];
+  request.isState = utils::strToBool(lines[5]);
+  request.isLfricConvention = utils::strToBool(lines[6]);
+  std::size_t numFields = std::stoul(lines[kRequestLines - 1]);
+  for (std::size_t i = 0; i < numFields; ++i) {
+    auto line = lines.begin() + kRequestLines + (i * kFieldLines);
+    consts::FieldMetadata fieldMetadata;
+    fieldMetadata.lfricReadName = line[consts::eLfricReadName];
+    fieldMetadata.lfricWriteName = line[consts::eLfricWriteName];
+    fieldMetadata.jediName = line[consts::eJediName];
+    fieldMetadata.lfricVertConfig = line[consts::eLfricVertConfig];
+    fieldMetadata.jediVertConfig = line[consts::eJediVertConfig];
+    fieldMetadata.units = line[consts::eUnits];
+    fieldMetadata.numberOfLevels = std::stoi(line[consts::eNumberOfLevels]);
+    fieldMetadata.noFirstLevel = utils::strToBool(line[consts::eNoFirstLevel]);
+    fieldMetadata.fileDataType = std::stoi(line[consts::eFileDataType]);
+    request.fieldMetadataVec.push_back(fieldMetadata);
+    request.varNames.push_back(line[consts::eFileDataType + 1]);
+    request.vertConfigNames.push_back(line[consts::eFileDataType + 2]);
+    request.numLevels.push_back(std::stoi(line[consts::eFileDataType + 3]));
+    request.dataTypes.push_back(std::stoi(line[consts::eFileDataType + 4]));
+  }
+  return request;
+}
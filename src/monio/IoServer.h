@@ -0,0 +1,90 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Constants.h"
+
+#include "eckit/mpi/Comm.h"
+
+namespace monio {
+/// \brief A request made by compute PEs to an I/O server PE. Fields are described by their
+///        metadata, the name of their variable in the file, their vertical configuration, the
+///        number of levels exchanged and their data type.
+struct IoRequest {
+  int type = consts::eStopRequest;
+  std::string filePath;
+  std::string gridName;
+  std::string initFilePath;
+  std::string dateTime;
+  bool isState = false;
+  bool isLfricConvention = true;
+  std::vector<consts::FieldMetadata> fieldMetadataVec;
+  std::vector<std::string> varNames;
+  std::vector<std::string> vertConfigNames;
+  std::vector<int> numLevels;
+  std::vector<int> dataTypes;
+};
+
+/// \brief Divides the PEs of a communicator into compute PEs and I/O server PEs. The last PEs of
+///        the communicator are the I/O servers. Each I/O server shares a communicator with all
+///        compute PEs, on which requests are broadcast and data are exchanged. Requests for a file
+///        are always handled by the same I/O server, in the order they are made.
+class IoServer {
+ public:
+  /// \brief Splits the communicator. A collective call.
+  IoServer(const eckit::mpi::Comm& mpiCommunicator,
+           const int numServerRanks);
+
+  IoServer()                             = delete;  //!< Deleted default constructor
+  IoServer(IoServer&&)                   = delete;  //!< Deleted move constructor
+  IoServer(const IoServer&)              = delete;  //!< Deleted copy constructor
+  IoServer& operator=(IoServer&&)        = delete;  //!< Deleted move assignment
+  IoServer& operator=(const IoServer&)   = delete;  //!< Deleted copy assignment
+
+  bool isServer() const;
+  std::size_t getNumServers() const;
+
+  /// \brief Returns the name of the communicator of the compute PEs, or of the I/O server PEs.
+  std::string getLocalCommName() const;
+
+  /// \brief Returns the rank of the I/O server PE in each communicator shared with compute PEs.
+  int getMpiRankServer() const;
+
+  /// \brief Returns the communicator shared with the I/O server that handles requests for a file.
+  ///        Used on compute PEs.
+  const eckit::mpi::Comm& getServerComm(const std::string& filePath) const;
+
+  /// \brief Returns the communicator shared with a given I/O server. Used on compute PEs.
+  const eckit::mpi::Comm& getServerComm(const std::size_t serverIndex) const;
+
+  /// \brief Returns the communicator shared with compute PEs. Used on I/O server PEs.
+  const eckit::mpi::Comm& getServerComm() const;
+
+  /// \brief Sends a request from the first compute PE to the I/O server, where it is returned. A
+  ///        collective call on a communicator shared by compute PEs and an I/O server.
+  void broadcastRequest(const eckit::mpi::Comm& serverComm,
+                              IoRequest& request) const;
+
+ private:
+  /// \brief Writes a request as a sequence of lines.
+  std::vector<char> encodeRequest(const IoRequest& request) const;
+
+  /// \brief Reads a request written by encodeRequest.
+  IoRequest decodeRequest(const std::vector<char>& buffer) const;
+
+  std::size_t numComputeRanks_;
+  std::size_t numServers_;
+  bool isServer_;
+  /// \brief Index of this I/O server. Zero on compute PEs.
+  std::size_t serverIndex_;
+};
+}  // namespace monio
@@ -8,15 +8,24 @@
 ******************************************************************************/
 #include "Monio.h"
 
+#include <algorithm>
+#include <exception>
+#include <future>  // NOLINT(build/c++11)
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "atlas/parallel/mpi/mpi.h"
+#include "eckit/mpi/Comm.h"
 #include "oops/util/Duration.h"
 #include "oops/util/Logger.h"
 
 #include "AttributeString.h"
 #include "Constants.h"
+#include "DistributionPlan.h"
+#include "IoServer.h"
+#include "OwnerPlan.h"
+#include "Remap.h"
 #include "Utils.h"
 #include "UtilsAtlas.h"
 #include "Writer.h"
@@ -40,14 +49,56 @@ monio::Monio* monio::Monio::this_ = nullptr;
 
 monio::Monio::~Monio() {
   std::cout << "Monio::~Monio()" << std::endl;  // Uses std::cout by design
+  if (pendingWrite_.valid() == true) {
+    pendingWrite_.wait();
+  }
   delete this_;
 }
 
+bool monio::Monio::startIoServer(const int numServerRanks) {
+  oops::Log::debug() << "Monio::startIoServer()" << std::endl;
+  if (this_ != nullptr) {
+    utils::throwException("Monio::startIoServer()> MONIO has already been used...");
+  }
+  std::unique_ptr<IoServer> ioServer = std::make_unique<IoServer>(atlas::mpi::comm(),
+                                                                  numServerRanks);
+  // MONIO on an I/O server PE works on that PE alone. Compute PEs work together, without the I/O
+  // server PEs.
+  if (ioServer->isServer() == true) {
+    eckit::mpi::setCommDefault("self");
+    get().serveRequests(*ioServer);
+    return false;
+  }
+  eckit::mpi::setCommDefault(ioServer->getLocalCommName().c_str());
+  get().ioServer_ = std::move(ioServer);
+  return true;
+}
+
+void monio::Monio::stopIoServer() {
+  oops::Log::debug() << "Monio::stopIoServer()" << std::endl;
+  flush();
+  if (ioServer_ == nullptr) {
+    Monio::get().closeFiles();
+    utils::throwException("Monio::stopIoServer()> I/O server PEs have not been started...");
+  }
+  for (std::size_t server = 0; server < ioServer_->getNumServers(); ++server) {
+    const eckit::mpi::Comm& serverComm = ioServer_->getServerComm(server);
+    IoRequest request;
+    request.type = consts::eStopRequest;
+    ioServer_->broadcastRequest(serverComm, request);
+    serverComm.barrier();  // Completes once the I/O server PE has finished all requests
+  }
+  ioServer_.reset();
+  initFilePaths_.clear();
+}
+
 void monio::Monio::readState(atlas::FieldSet& localFieldSet,
                             const std::vector<consts::FieldMetadata>& fieldMetadataVec,
                             const std::string& filePath,
-                            const util::DateTime& dateTime) {
+                            const util::DateTime& dateTime,
+                            const int readMode) {
   oops::Log::debug() << "Monio::readState()" << std::endl;
+  flushForRead(filePath);
   if (localFieldSet.size() == 0) {
     Monio::get().closeFiles();
     utils::throwException("Monio::readState()> localFieldSet has zero fields...");
@@ -55,40 +106,13 @@ void monio::Monio::readState(atlas::FieldSet& localFieldSet,
   if (filePath.length() != 0) {
     if (utils::fileExists(filePath)) {
       try {
-        for (const auto& fieldMetadata : fieldMetadataVec) {
-          auto& localField = localFieldSet[fieldMetadata.jediName];
-          atlas::Field globalField = utilsatlas::getGlobalField(localField);
-          if (mpiCommunicator_.rank() == mpiRankOwner_) {
-            auto& functionSpace = globalField.functionspace();
-            auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
-            // Initialise file
-            int variableConvention = initialiseFile(grid.name(), filePath, true);
-            // getFileData returns a copy of FileData (with required LFRic mesh data), so read data
-            // is discarded when FileData goes out-of-scope for reading subsequent fields.
-            FileData fileData = getFileData(grid.name());
-            // Configure read name
-            std::string readName = fieldMetadata.lfricReadName;
-            if (variableConvention == consts::eJediConvention) {
-              readName = fieldMetadata.jediName;
-            }
-            if (utils::findInVector(consts::kMissingVariableNames, readName) == false) {
-              oops::Log::debug() << "Monio::readState() processing data for> \"" <<
-                                    readName << "\"..." << std::endl;
-              // Read fields into memory
-              reader_.readDatumAtTime(fileData, readName, dateTime,
-                                      std::string(consts::kTimeDimName));
-              atlasReader_.populateFieldWithFileData(globalField, fileData, fieldMetadata, readName,
-                                                    variableConvention == consts::eLfricConvention);
-            } else {
-              oops::Log::info() << "Monio::readState()> Variable \"" + fieldMetadata.jediName +
-                                   "\" not defined in LFRic. Skipping read..." << std::endl;
-            }
-          }
-          auto& functionSpace = globalField.functionspace();
-          functionSpace.scatter(globalField, localField);
-          localField.haloExchange();
+        if (ioServer_ != nullptr) {
+          readFieldSetFromServer(localFieldSet, fieldMetadataVec, filePath, dateTime, true);
+        } else if (readMode == consts::eParallelRead) {
+          readFieldSetParallel(localFieldSet, fieldMetadataVec, filePath, dateTime, true);
+        } else {
+          readFieldSetSerial(localFieldSet, fieldMetadataVec, filePath, dateTime, true);
         }
-        reader_.closeFile();
       } catch (netCDF::exceptions::NcException& exception) {
         Monio::get().closeFiles();
         std::string exceptionMessage = exception.what();
@@ -104,10 +128,56 @@ void monio::Monio::readState(atlas::FieldSet& localFieldSet,
   }
 }
 
+void monio::Monio::readStates(std::vector<atlas::FieldSet>& localFieldSets,
+                             const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                             const std::string& filePath,
+                             const std::vector<util::DateTime>& dateTimes) {
+  oops::Log::debug() << "Monio::readStates()" << std::endl;
+  flushForRead(filePath);
+  if (localFieldSets.size() == 0 || localFieldSets.size() != dateTimes.size()) {
+    Monio::get().closeFiles();
+    utils::throwException("Monio::readStates()> Numbers of field sets and date-times do not "
+                          "match, or are zero...");
+  }
+  for (const auto& localFieldSet : localFieldSets) {
+    if (localFieldSet.size() == 0) {
+      Monio::get().closeFiles();
+      utils::throwException("Monio::readStates()> localFieldSets has a field set with zero "
+                            "fields...");
+    }
+  }
+  if (filePath.length() != 0) {
+    if (utils::fileExists(filePath)) {
+      try {
+        if (ioServer_ != nullptr || memoryBudget_ > 0) {
+          for (std::size_t t = 0; t < localFieldSets.size(); ++t) {
+            readState(localFieldSets[t], fieldMetadataVec, filePath, dateTimes[t]);
+          }
+        } else {
+          readFieldSetsSerial(localFieldSets, fieldMetadataVec, filePath, dateTimes);
+        }
+      } catch (netCDF::exceptions::NcException& exception) {
+        Monio::get().closeFiles();
+        std::string exceptionMessage = exception.what();
+        utils::throwException("Monio::readStates()> An exception has occurred: " +
+                              exceptionMessage);
+      }
+    } else {
+      Monio::get().closeFiles();
+      utils::throwException("Monio::readStates()> File \"" + filePath + "\" does not exist...");
+    }
+  } else {
+    Monio::get().closeFiles();
+    utils::throwException("Monio::readStates()> No file path supplied...");
+  }
+}
+
 void monio::Monio::readIncrements(atlas::FieldSet& localFieldSet,
                             const std::vector<consts::FieldMetadata>& fieldMetadataVec,
-                            const std::string& filePath) {
+                            const std::string& filePath,
+                            const int readMode) {
   oops::Log::debug() << "Monio::readIncrements()" << std::endl;
+  flushForRead(filePath);
   if (localFieldSet.size() == 0) {
     Monio::get().closeFiles();
     utils::throwException("Monio::readIncrements()> localFieldSet has zero fields...");
@@ -115,35 +185,14 @@ void monio::Monio::readIncrements(atlas::FieldSet& localFieldSet,
   if (filePath.length() != 0) {
     if (utils::fileExists(filePath)) {
       try {
-        for (const auto& fieldMetadata : fieldMetadataVec) {
-          auto& localField = localFieldSet[fieldMetadata.jediName];
-          atlas::Field globalField = utilsatlas::getGlobalField(localField);
-          if (mpiCommunicator_.rank() == mpiRankOwner_) {
-            auto& functionSpace = globalField.functionspace();
-            auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
-
-            // Initialise file
-            int variableConvention = initialiseFile(grid.name(), filePath);
-            // getFileData returns a copy of FileData (with required LFRic mesh data), so read data
-            // is discarded when FileData goes out-of-scope for reading subsequent fields.
-            FileData fileData = getFileData(grid.name());
-            // Configure read name
-            std::string readName = fieldMetadata.lfricReadName;
-            if (variableConvention == consts::eJediConvention) {
-              readName = fieldMetadata.jediName;
-            }
-            oops::Log::debug() << "Monio::readIncrements() processing data for> \"" <<
-                                  readName << "\"..." << std::endl;
-            // Read fields into memory
-            reader_.readFullDatum(fileData, readName);
-            atlasReader_.populateFieldWithFileData(globalField, fileData, fieldMetadata, readName,
-                                                   variableConvention == consts::eLfricConvention);
-          }
-          auto& functionSpace = globalField.functionspace();
-          functionSpace.scatter(globalField, localField);
-          localField.haloExchange();
+        if (ioServer_ != nullptr) {
+          readFieldSetFromServer(localFieldSet, fieldMetadataVec, filePath, util::DateTime(),
+                                 false);
+        } else if (readMode == consts::eParallelRead) {
+          readFieldSetParallel(localFieldSet, fieldMetadataVec, filePath, util::DateTime(), false);
+        } else {
+          readFieldSetSerial(localFieldSet, fieldMetadataVec, filePath, util::DateTime(), false);
         }
-        reader_.closeFile();
       } catch (netCDF::exceptions::NcException& exception) {
         Monio::get().closeFiles();
         std::string exceptionMessage = exception.what();
@@ -163,55 +212,25 @@ void monio::Monio::readIncrements(atlas::FieldSet& localFieldSet,
 void monio::Monio::writeIncrements(const atlas::FieldSet& localFieldSet,
                                    const std::vector<consts::FieldMetadata>& fieldMetadataVec,
                                    const std::string& filePath,
-                                   const bool isLfricConvention) {
+                                   const bool isLfricConvention,
+                                   const int writeMode) {
   oops::Log::debug() << "Monio::writeIncrements()" << std::endl;
+  flush();
   if (localFieldSet.size() == 0) {
     Monio::get().closeFiles();
     utils::throwException("Monio::writeIncrements()> localFieldSet has zero fields...");
   }
   if (filePath.length() != 0) {
     try {
-      auto& functionSpace = localFieldSet[0].functionspace();
-      auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
-      FileData fileData = getFileData(grid.name());
-      cleanFileData(fileData);  // Remove metadata required for reading, but not for writing.
-      if (isLfricConvention == false) {
-        addJediData(fileData);
-      }
-      writer_.openFile(filePath);
-      for (const auto& fieldMetadata : fieldMetadataVec) {
-        auto& localField = localFieldSet[fieldMetadata.jediName];
-        atlas::Field globalField = utilsatlas::getGlobalField(localField);
-        if (mpiCommunicator_.rank() == mpiRankOwner_) {
-          // Configure write name
-          std::string writeName;
-          std::string verticalConfigName;
-          if (isLfricConvention == true) {
-            writeName = fieldMetadata.lfricWriteName;
-            verticalConfigName = fieldMetadata.lfricVertConfig;
-          } else if (isLfricConvention == false && fieldMetadata.jediName == globalField.name()) {
-            writeName = fieldMetadata.jediName;
-            verticalConfigName = fieldMetadata.jediVertConfig;
-          } else {
-            Monio::get().closeFiles();
-            utils::throwException("Monio::writeIncrements()> "
-                                  "Field metadata configuration error...");
-          }
-          oops::Log::debug() << "Monio::writeIncrements() processing data for> \"" <<
-                                writeName << "\"..." << std::endl;
-
-          atlasWriter_.populateFileDataWithField(fileData,
-                                                 globalField,
-                                                 fieldMetadata,
-                                                 writeName,
-                                                 verticalConfigName,
-                                                 isLfricConvention);
-          writer_.writeMetadata(fileData.getMetadata());
-          writer_.writeData(fileData);
-          fileData.clearData();  // Written and globalised field data no longer required
-        }
+      if (ioServer_ != nullptr) {
+        writeFieldSetToServer(localFieldSet, fieldMetadataVec, filePath, isLfricConvention, false);
+      } else if (writeMode == consts::eParallelWrite) {
+        writeFieldSetParallel(localFieldSet, fieldMetadataVec, filePath, isLfricConvention, false);
+      } else if (writeMode == consts::eAsyncWrite) {
+        writeFieldSetAsync(localFieldSet, fieldMetadataVec, filePath, isLfricConvention, false);
+      } else {
+        writeFieldSetSerial(localFieldSet, fieldMetadataVec, filePath, isLfricConvention, false);
       }
-      writer_.closeFile();
     } catch (netCDF::exceptions::NcException& exception) {
       Monio::get().closeFiles();
       std::string exceptionMessage = exception.what();
@@ -226,54 +245,25 @@ void monio::Monio::writeIncrements(const atlas::FieldSet& localFieldSet,
 void monio::Monio::writeState(const atlas::FieldSet& localFieldSet,
                               const std::vector<consts::FieldMetadata>& fieldMetadataVec,
                               const std::string& filePath,
-                              const bool isLfricConvention) {
+                              const bool isLfricConvention,
+                              const int writeMode) {
   oops::Log::debug() << "Monio::writeState()" << std::endl;
+  flush();
   if (localFieldSet.size() == 0) {
     Monio::get().closeFiles();
     utils::throwException("Monio::writeState()> localFieldSet has zero fields...");
   }
   if (filePath.length() != 0) {
     try {
-      auto& functionSpace = localFieldSet[0].functionspace();
-      auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
-      FileData fileData = getFileData(grid.name());
-      cleanFileData(fileData);  // Remove metadata required for reading, but not for writing.
-      if (isLfricConvention == false) {
-        addJediData(fileData);
-      }
-      writer_.openFile(filePath);
-      for (const auto& fieldMetadata : fieldMetadataVec) {
-        auto& localField = localFieldSet[fieldMetadata.jediName];
-        atlas::Field globalField = utilsatlas::getGlobalField(localField);
-        if (mpiCommunicator_.rank() == mpiRankOwner_) {
-          // Configure write name
-          std::string writeName;
-          std::string verticalConfigName;
-          if (isLfricConvention == true) {
-            writeName = fieldMetadata.lfricReadName;
-            verticalConfigName = fieldMetadata.lfricVertConfig;
-          } else if (isLfricConvention == false && fieldMetadata.jediName == globalField.name()) {
-            writeName = fieldMetadata.jediName;
-            verticalConfigName = fieldMetadata.jediVertConfig;
-          } else {
-            Monio::get().closeFiles();
-            utils::throwException("Monio::writeState()> Field metadata configuration error...");
-          }
-          oops::Log::debug() << "Monio::writeState() processing data for> \"" <<
-                                  writeName << "\"..." << std::endl;
-
-          atlasWriter_.populateFileDataWithField(fileData,
-                                                 globalField,
-                                                 fieldMetadata,
-                                                 writeName,
-                                                 verticalConfigName,
-                                                 isLfricConvention);
-          writer_.writeMetadata(fileData.getMetadata());
-          writer_.writeData(fileData);
-          fileData.clearData();  // Written and globalised field data no longer required
-        }
+      if (ioServer_ != nullptr) {
+        writeFieldSetToServer(localFieldSet, fieldMetadataVec, filePath, isLfricConvention, true);
+      } else if (writeMode == consts::eParallelWrite) {
+        writeFieldSetParallel(localFieldSet, fieldMetadataVec, filePath, isLfricConvention, true);
+      } else if (writeMode == consts::eAsyncWrite) {
+        writeFieldSetAsync(localFieldSet, fieldMetadataVec, filePath, isLfricConvention, true);
+      } else {
+        writeFieldSetSerial(localFieldSet, fieldMetadataVec, filePath, isLfricConvention, true);
       }
-      writer_.closeFile();
     } catch (netCDF::exceptions::NcException& exception) {
       Monio::get().closeFiles();
       std::string exceptionMessage = exception.what();
@@ -288,6 +278,7 @@ void monio::Monio::writeState(const atlas::FieldSet& localFieldSet,
 void monio::Monio::writeFieldSet(const atlas::FieldSet& localFieldSet,
                                  const std::string& filePath) {
   oops::Log::debug() << "Monio::writeFieldSet()" << std::endl;
+  flush();
   if (localFieldSet.size() == 0) {
     Monio::get().closeFiles();
     utils::throwException("Monio::writeFieldSet()> localFieldSet has zero fields...");
@@ -295,14 +286,28 @@ void monio::Monio::writeFieldSet(const atlas::FieldSet& localFieldSet,
   if (filePath.length() != 0) {
     try {
       FileData fileData;  // Object needs to persist across fields for correct metadata creation
-      writer_.openFile(filePath);
-      for (const auto& localField : localFieldSet) {
-        atlas::Field globalField = utilsatlas::getGlobalField(localField);
-        if (mpiCommunicator_.rank() == mpiRankOwner_) {
-          atlasWriter_.populateFileDataWithField(fileData, globalField, globalField.name());
-          writer_.writeMetadata(fileData.getMetadata());
-          writer_.writeData(fileData);
-          fileData.clearData();  // Written and globalised field data no longer required
+      if (mpiCommunicator_.rank() == mpiRankWriteOwner_) {
+        writer_.openFile(filePath);
+      }
+      // Fields are gathered in batches, each with a single collective
+      for (std::size_t batchStart = 0; batchStart < std::size_t(localFieldSet.size());
+           batchStart += consts::kGatherBatchSize) {
+        std::size_t batchEnd = std::min(batchStart + consts::kGatherBatchSize,
+                                        std::size_t(localFieldSet.size()));
+        std::vector<atlas::Field> localFields;
+        for (std::size_t i = batchStart; i < batchEnd; ++i) {
+          localFields.push_back(localFieldSet[i]);
+        }
+        std::vector<atlas::Field> globalFields =
+            utilsatlas::getGlobalFields(localFields, mpiCommunicator_, mpiRankWriteOwner_);
+        if (mpiCommunicator_.rank() == mpiRankWriteOwner_) {
+          for (atlas::Field& globalField : globalFields) {
+            atlasWriter_.populateFileDataWithField(fileData, globalField, globalField.name());
+            writer_.writeMetadata(fileData.getMetadata());
+            writer_.writeData(fileData);
+            fileData.clearData();  // Written field data no longer required
+            globalField = atlas::Field();  // Globalised field data no longer required
+          }
         }
       }
       writer_.closeFile();
@@ -317,36 +322,111 @@ void monio::Monio::writeFieldSet(const atlas::FieldSet& localFieldSet,
   }
 }
 
+void monio::Monio::setMpiRankOwners(const std::vector<int>& mpiRankOwners) {
+  oops::Log::debug() << "Monio::setMpiRankOwners()" << std::endl;
+  setMpiRankOwners(mpiRankOwners, mpiRankOwners);
+}
+
+void monio::Monio::setMpiRankOwners(const std::vector<int>& mpiRankReadOwners,
+                                    const std::vector<int>& mpiRankWriteOwners) {
+  oops::Log::debug() << "Monio::setMpiRankOwners()" << std::endl;
+  flush();
+  std::vector<std::size_t> readRanks = getMpiRankOwners(mpiRankReadOwners);
+  std::vector<std::size_t> writeRanks = getMpiRankOwners(mpiRankWriteOwners);
+  closeFiles();
+  mpiRankReadOwners_ = std::move(readRanks);
+  mpiRankReadOwner_ = mpiRankReadOwners_.front();
+  mpiRankWriteOwners_ = std::move(writeRanks);
+  mpiRankWriteOwner_ = mpiRankWriteOwners_.front();
+  filesData_.clear();  // File data are only held by owner PEs
+  filesDataIds_.clear();
+  initFilePaths_.clear();
+  // Each owner PE configures its I/O classes with its own rank. Others use the primary owners.
+  // Write owner PEs read the files they are initialised from, so configure Reader as well.
+  int mpiRank = mpiCommunicator_.rank();
+  reader_.setMpiRankOwner(isMpiRankOwner() == true ? mpiRank : mpiRankReadOwner_);
+  atlasReader_.setMpiRankOwner(isMpiRankReadOwner() == true ? mpiRank : mpiRankReadOwner_);
+  writer_.setMpiRankOwner(isMpiRankWriteOwner() == true ? mpiRank : mpiRankWriteOwner_);
+  atlasWriter_.setMpiRankOwner(isMpiRankWriteOwner() == true ? mpiRank : mpiRankWriteOwner_);
+}
+
+void monio::Monio::setLfricAtlasMapCacheDir(const std::string& cacheDir) {
+  oops::Log::debug() << "Monio::setLfricAtlasMapCacheDir()" << std::endl;
+  lfricAtlasMapCacheDir_ = cacheDir;
+}
+
+void monio::Monio::setMemoryBudget(const std::size_t memoryBudget) {
+  oops::Log::debug() << "Monio::setMemoryBudget()" << std::endl;
+  memoryBudget_ = memoryBudget;
+}
+
+void monio::Monio::setNodeAwareExchange(const bool isNodeAware) {
+  oops::Log::debug() << "Monio::setNodeAwareExchange()" << std::endl;
+  isNodeAware_ = isNodeAware;
+}
+
+void monio::Monio::setRemapThreads(const int numThreads) {
+  oops::Log::debug() << "Monio::setRemapThreads()" << std::endl;
+  threadPool_.setNumThreads(numThreads);  // Asynchronous writes are remapped before hand-off
+}
+
 void monio::Monio::closeFiles() {
   oops::Log::debug() << "Monio::closeFiles()" << std::endl;
+  if (utils::isBackgroundThread() == true) {
+    return;  // Files in use by other threads are closed by the thread that raises the error
+  }
   reader_.closeFile();
   writer_.closeFile();
 }
 
+void monio::Monio::prefetchFile(const std::string& filePath) {
+  oops::Log::debug() << "Monio::prefetchFile()" << std::endl;
+  flushForRead(filePath);
+  if (isMpiRankReadOwner() == true && utils::fileExists(filePath) == true) {
+    reader_.prefetchFile(filePath);
+  }
+}
+
+void monio::Monio::flush() {
+  reader_.waitForPrefetch();
+  if (pendingWrite_.valid() == true) {
+    oops::Log::debug() << "Monio::flush()" << std::endl;
+    try {
+      pendingWrite_.get();  // Rethrows any exception from the background thread
+    } catch (std::exception& exception) {
+      pendingWritePath_.clear();
+      closeFiles();
+      std::string exceptionMessage = exception.what();
+      utils::throwException("Monio::flush()> An exception occurred: " + exceptionMessage);
+    }
+  }
+  pendingWritePath_.clear();
+}
+
 int monio::Monio::initialiseFile(const atlas::Grid& grid,
                                  const std::string& filePath,
                                  bool doCreateDateTimes) {
   oops::Log::debug() << "Monio::initialiseFile()" << std::endl;
+  flush();
   int variableConvention = consts::eLfricConvention;  // LFRic convention is default
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
-    FileData& fileData = createFileData(grid.name(), filePath);
-    reader_.openFile(filePath);
-    reader_.readMetadata(fileData);
-    // Read data
-    std::vector<std::string> meshVars =
-        fileData.getMetadata().findVariableNames(std::string(consts::kLfricMeshTerm));
-    reader_.readFullData(fileData, meshVars);
-    reader_.readFullDatum(fileData, std::string(consts::kVerticalFullName));
-    reader_.readFullDatum(fileData, std::string(consts::kVerticalHalfName));
-    // Process read data
-    createLfricAtlasMap(fileData, grid);
-    if (doCreateDateTimes == true) {
-      reader_.readFullDatum(fileData, std::string(consts::kTimeVarName));
-      createDateTimes(fileData,
-                      std::string(consts::kTimeVarName),
-                      std::string(consts::kTimeOriginName));
-    }
-    variableConvention = fileData.getMetadata().getVariableConvention();
+  if (ioServer_ != nullptr) {
+    const eckit::mpi::Comm& serverComm = ioServer_->getServerComm(filePath);
+    IoRequest request;
+    request.type = consts::eInitialiseRequest;
+    request.filePath = filePath;
+    request.gridName = grid.name();
+    request.isState = doCreateDateTimes;
+    ioServer_->broadcastRequest(serverComm, request);
+    serverComm.broadcast(variableConvention, ioServer_->getMpiRankServer());
+    initFilePaths_[grid.name()] = filePath;
+    return variableConvention;
+  }
+  initFilePaths_[grid.name()] = filePath;
+  if (isMpiRankOwner() == true) {
+    variableConvention = initialiseFileData(grid, filePath, doCreateDateTimes);
+    if (isMpiRankReadOwner() == false) {
+      reader_.closeFile();  // The file is only read from by read owner PEs
+    }
   }
   return variableConvention;
 }
@@ -356,14 +436,1204 @@ int monio::Monio::initialiseFile(const atlas::Grid& grid,
 monio::Monio::Monio(const eckit::mpi::Comm& mpiCommunicator,
                     const int mpiRankOwner) :
       mpiCommunicator_(mpiCommunicator),
-      mpiRankOwner_(mpiRankOwner),
-      reader_(mpiCommunicator, mpiRankOwner_),
-      writer_(mpiCommunicator, mpiRankOwner_),
-      atlasReader_(mpiCommunicator, mpiRankOwner_),
-      atlasWriter_(mpiCommunicator, mpiRankOwner_) {
+      mpiRankReadOwner_(mpiRankOwner),
+      mpiRankReadOwners_({mpiRankReadOwner_}),
+      mpiRankWriteOwner_(mpiRankOwner),
+      mpiRankWriteOwners_({mpiRankWriteOwner_}),
+      reader_(mpiCommunicator, mpiRankReadOwner_),
+      writer_(mpiCommunicator, mpiRankWriteOwner_),
+      parallelReader_(mpiCommunicator),
+      parallelWriter_(mpiCommunicator),
+      atlasReader_(mpiCommunicator, mpiRankReadOwner_, threadPool_),
+      atlasWriter_(mpiCommunicator, mpiRankWriteOwner_, threadPool_) {
   oops::Log::debug() << "Monio::Monio()" << std::endl;
 }
 
+void monio::Monio::openSession(const atlas::Grid& grid,
+                               const std::string& filePath,
+                               const bool isState) {
+  oops::Log::debug() << "Monio::openSession()" << std::endl;
+  flushForRead(filePath);
+  if (sessionFilePath_.size() != 0) {
+    Monio::get().closeFiles();
+    utils::throwException("Monio::openSession()> A session is already open for \"" +
+                          sessionFilePath_ + "\"...");
+  }
+  if (filePath.length() == 0) {
+    Monio::get().closeFiles();
+    utils::throwException("Monio::openSession()> No file path supplied...");
+  }
+  if (utils::fileExists(filePath) == false) {
+    Monio::get().closeFiles();
+    utils::throwException("Monio::openSession()> File \"" + filePath + "\" does not exist...");
+  }
+  try {
+    if (ioServer_ != nullptr) {
+      sessionVariableConvention_ = initialiseFile(grid, filePath, isState);
+    } else {
+      sessionVariableConvention_ = initialiseReadFile(grid, filePath, isState);
+      mpiCommunicator_.broadcast(sessionVariableConvention_, mpiRankReadOwner_);
+      if (isMpiRankReadOwner() == true) {
+        sessionFileId_ = filesDataIds_[grid.name()];
+      }
+    }
+  } catch (netCDF::exceptions::NcException& exception) {
+    Monio::get().closeFiles();
+    std::string exceptionMessage = exception.what();
+    utils::throwException("Monio::openSession()> An exception has occurred: " + exceptionMessage);
+  }
+  sessionFilePath_ = filePath;
+}
+
+void monio::Monio::readSession(atlas::FieldSet& localFieldSet,
+                         const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                         const util::DateTime& dateTime,
+                         const bool isState) {
+  oops::Log::debug() << "Monio::readSession()" << std::endl;
+  flushForRead(sessionFilePath_);
+  if (localFieldSet.size() == 0) {
+    Monio::get().closeFiles();
+    utils::throwException("Monio::readSession()> localFieldSet has zero fields...");
+  }
+  try {
+    if (ioServer_ != nullptr) {
+      readFieldSetFromServer(localFieldSet, fieldMetadataVec, sessionFilePath_, dateTime, isState);
+    } else {
+      readFieldSetSerial(localFieldSet, fieldMetadataVec, sessionFilePath_, dateTime, isState);
+    }
+  } catch (netCDF::exceptions::NcException& exception) {
+    Monio::get().closeFiles();
+    std::string exceptionMessage = exception.what();
+    utils::throwException("Monio::readSession()> An exception has occurred: " + exceptionMessage);
+  }
+}
+
+void monio::Monio::closeSession() {
+  oops::Log::debug() << "Monio::closeSession()" << std::endl;
+  if (sessionFilePath_.size() != 0) {
+    sessionFilePath_.clear();
+    sessionFileId_.clear();
+    reader_.closeFile();
+  }
+}
+
+bool monio::Monio::isSessionOpen() {
+  if (sessionFilePath_.size() != 0 && ioServer_ == nullptr && isMpiRankReadOwner() == true) {
+    return reader_.isOpen(sessionFilePath_);
+  }
+  return sessionFilePath_.size() != 0;
+}
+
+void monio::Monio::flushForRead(const std::string& filePath) {
+  if (pendingWritePath_.size() != 0 && pendingWritePath_ == filePath) {
+    flush();
+    mpiCommunicator_.barrier();  // The file is complete before it is opened for reading
+  } else if (isMpiRankReadOwner() == true) {
+    reader_.waitForPrefetch();
+    if (pendingWrite_.valid() == true) {
+      pendingWrite_.wait();  // Any error is raised by the next flush
+    }
+  }
+}
+
+int monio::Monio::initialiseReadFile(const atlas::Grid& grid,
+                                     const std::string& filePath,
+                                     const bool doCreateDateTimes) {
+  oops::Log::debug() << "Monio::initialiseReadFile()" << std::endl;
+  int variableConvention = consts::eLfricConvention;  // LFRic convention is default
+  initFilePaths_[grid.name()] = filePath;
+  if (isMpiRankReadOwner() == true) {
+    variableConvention = initialiseFileData(grid, filePath, doCreateDateTimes);
+  }
+  return variableConvention;
+}
+
+void monio::Monio::initialiseWriteFile(const atlas::Grid& grid) {
+  oops::Log::debug() << "Monio::initialiseWriteFile()" << std::endl;
+  auto it = initFilePaths_.find(grid.name());
+  if (isMpiRankWriteOwner() == true && isMpiRankReadOwner() == false &&
+      it != initFilePaths_.end()) {
+    initialiseFileData(grid, it->second, false);
+    reader_.closeFile();
+  }
+}
+
+int monio::Monio::initialiseFileData(const atlas::Grid& grid,
+                                     const std::string& filePath,
+                                     const bool doCreateDateTimes) {
+  oops::Log::debug() << "Monio::initialiseFileData()" << std::endl;
+  std::string fileId = utils::getFileId(filePath);
+  auto it = filesData_.find(grid.name());
+  if (it != filesData_.end() && fileId.size() != 0 && filesDataIds_[grid.name()] == fileId &&
+      (doCreateDateTimes == false || it->second.getDateTimes().size() != 0)) {
+    // File is unchanged since it was initialised. Only the file handle is required.
+    oops::Log::debug() << "Monio::initialiseFileData()> Reusing file data for \"" <<
+                          filePath << "\"..." << std::endl;
+    reader_.openFile(filePath);
+    return it->second.getMetadata().getVariableConvention();
+  }
+  // Data from a previous file at this resolution are kept to allow reuse of its map
+  FileData previousFileData;
+  if (it != filesData_.end()) {
+    previousFileData = std::move(it->second);
+  }
+  FileData& fileData = createFileData(grid.name(), filePath);
+  filesDataIds_[grid.name()] = fileId;
+  reader_.openFile(filePath);
+  reader_.readMetadata(fileData);
+  // Read data
+  std::vector<std::string> meshVars =
+      fileData.getMetadata().findVariableNames(std::string(consts::kLfricMeshTerm));
+  reader_.readFullData(fileData, meshVars);
+  reader_.readFullDatum(fileData, std::string(consts::kVerticalFullName));
+  reader_.readFullDatum(fileData, std::string(consts::kVerticalHalfName));
+  // Process read data
+  createLfricAtlasMap(fileData, grid, previousFileData);
+  if (doCreateDateTimes == true) {
+    reader_.readFullDatum(fileData, std::string(consts::kTimeVarName));
+    createDateTimes(fileData,
+                    std::string(consts::kTimeVarName),
+                    std::string(consts::kTimeOriginName));
+  }
+  return fileData.getMetadata().getVariableConvention();
+}
+
+std::vector<std::size_t> monio::Monio::getMpiRankOwners(
+                                                 const std::vector<int>& mpiRankOwners) const {
+  if (mpiRankOwners.size() == 0) {
+    utils::throwException("Monio::setMpiRankOwners()> No owner PEs supplied...");
+  }
+  std::vector<std::size_t> mpiRanks;
+  for (const int mpiRankOwner : mpiRankOwners) {
+    if (mpiRankOwner < 0 || std::size_t(mpiRankOwner) >= mpiCommunicator_.size()) {
+      utils::throwException("Monio::setMpiRankOwners()> Owner PE " +
+                            std::to_string(mpiRankOwner) + " is outside of the communicator...");
+    }
+    if (std::find(mpiRanks.begin(), mpiRanks.end(), mpiRankOwner) != mpiRanks.end()) {
+      utils::throwException("Monio::setMpiRankOwners()> Owner PE " +
+                            std::to_string(mpiRankOwner) + " is duplicated...");
+    }
+    mpiRanks.push_back(mpiRankOwner);
+  }
+  return mpiRanks;
+}
+
+void monio::Monio::readFieldSetSerial(atlas::FieldSet& localFieldSet,
+                                      const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                      const std::string& filePath,
+                                      const util::DateTime& dateTime,
+                                      const bool isState) {
+  oops::Log::debug() << "Monio::readFieldSetSerial()" << std::endl;
+  auto& functionSpace = localFieldSet[0].functionspace();
+  auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
+  // File geometry and the time step are derived once per read, for use with all fields. The file
+  // of an open session is initialised once, and reinitialised only where its file data have been
+  // replaced, or the file closed, by a read of another file.
+  const bool isSession = filePath == sessionFilePath_;
+  int variableConvention = sessionVariableConvention_;
+  if (isSession == false) {
+    variableConvention = initialiseReadFile(grid, filePath, isState);
+  } else if (isMpiRankReadOwner() == true && (reader_.isOpen(filePath) == false ||
+                                              filesDataIds_[grid.name()] != sessionFileId_)) {
+    initialiseFileData(grid, filePath, isState);
+    sessionFileId_ = filesDataIds_[grid.name()];
+  }
+  std::size_t timeStep = 0;
+  if (isMpiRankReadOwner() == true && isState == true) {
+    timeStep = reader_.findTimeStep(filesData_.at(grid.name()), dateTime);
+  }
+  if (isSession == false) {
+    mpiCommunicator_.broadcast(variableConvention, mpiRankReadOwner_);
+  }
+  // Configure read names. Fields without variables in the file are left unchanged.
+  std::vector<std::string> readNames;
+  std::vector<std::size_t> readIndices;
+  getReadNames(fieldMetadataVec, variableConvention, isState, readNames, readIndices);
+  // Fields are assigned to owner PEs in turn. Each round of fields is read by the owner PEs at the
+  // same time, before the fields of each owner PE are scattered together.
+  std::size_t numReads = readIndices.size();
+  std::size_t numOwners = mpiRankReadOwners_.size();
+  std::size_t roundSize = numOwners * consts::kGatherBatchSize;
+  // Each owner PE reads its next field on a background thread, while the current field is
+  // remapped and scattered. Read-ahead uses a separate FileData, so that only the background
+  // thread accesses the file.
+  std::vector<std::size_t> ownerReadIndices;
+  FileData prefetchFileData;
+  std::future<std::shared_ptr<DataContainerBase>> pendingRead;
+  if (isMpiRankReadOwner() == true) {
+    std::size_t ownerPos = std::distance(mpiRankReadOwners_.begin(),
+        std::find(mpiRankReadOwners_.begin(), mpiRankReadOwners_.end(), mpiCommunicator_.rank()));
+    for (std::size_t k = ownerPos; k < numReads; k += numOwners) {
+      ownerReadIndices.push_back(readIndices[k]);
+    }
+    prefetchFileData.getMetadata() = filesData_.at(grid.name()).getMetadata();
+    if (ownerReadIndices.size() != 0 && memoryBudget_ == 0) {
+      pendingRead = readDatumAsync(prefetchFileData, filesData_.at(grid.name()),
+                                   readNames[ownerReadIndices.front()], timeStep, isState);
+    }
+  }
+  // Each owner PE packs the points of each PE directly from the read data, by their file indices
+  std::vector<std::unique_ptr<OwnerPlan>> ownerPlans =
+      createOwnerPlans(functionSpace, grid.name(), mpiRankReadOwners_);
+  if (memoryBudget_ > 0) {
+    // Read-ahead is not used, so the FileData held for it is used for reads of slabs
+    readFieldsStreamed(localFieldSet, fieldMetadataVec, readNames, readIndices, prefetchFileData,
+                       ownerPlans, timeStep, variableConvention == consts::eLfricConvention);
+  } else {
+    std::size_t ownerReadPos = 0;
+    for (std::size_t roundStart = 0; roundStart < numReads; roundStart += roundSize) {
+      std::size_t roundEnd = std::min(roundStart + roundSize, numReads);
+      for (std::size_t owner = 0; owner < numOwners; ++owner) {
+        std::vector<atlas::Field> localFields;
+        std::vector<consts::FieldMetadata> localFieldMetadataVec;
+        std::vector<std::shared_ptr<DataContainerBase>> dataContainers;
+        for (std::size_t k = roundStart + owner; k < roundEnd; k += numOwners) {
+          const std::size_t i = readIndices[k];
+          const auto& fieldMetadata = fieldMetadataVec[i];
+          localFields.push_back(localFieldSet[fieldMetadata.jediName]);
+          localFieldMetadataVec.push_back(fieldMetadata);
+          if (mpiCommunicator_.rank() == mpiRankReadOwners_[owner]) {
+            const std::string& readName = readNames[i];
+            FileData& fileData = filesData_.at(grid.name());
+            oops::Log::debug() << "Monio::readFieldSetSerial() processing data for> \"" <<
+                                  readName << "\"..." << std::endl;
+            // Read data are discarded once the fields are scattered, unless already held as part of
+            // the file's initialisation data.
+            if (pendingRead.valid() == true) {
+              dataContainers.push_back(pendingRead.get());
+            } else if (fileData.getData().isContainerPresent(readName) == true) {
+              dataContainers.push_back(fileData.getData().getContainer(readName));
+            } else {
+              dataContainers.push_back(readDatumAsync(prefetchFileData, fileData, readName,
+                                                      timeStep, isState).get());
+            }
+            if (++ownerReadPos < ownerReadIndices.size()) {
+              pendingRead = readDatumAsync(prefetchFileData, fileData,
+                                           readNames[ownerReadIndices[ownerReadPos]],
+                                           timeStep, isState);
+            }
+          }
+        }
+        atlasReader_.populateFieldsWithOwnerPlan(localFields, dataContainers,
+                                                   localFieldMetadataVec,
+                                                   variableConvention == consts::eLfricConvention,
+                                                   *ownerPlans[owner]);
+      }
+    }
+  }
+  // A single halo exchange for all fields
+  atlas::FieldSet haloFieldSet;
+  for (const auto& fieldMetadata : fieldMetadataVec) {
+    haloFieldSet.add(localFieldSet[fieldMetadata.jediName]);
+  }
+  functionSpace.haloExchange(haloFieldSet);
+  if (isSession == false) {
+    reader_.closeFile();
+  }
+}
+
+void monio::Monio::readFieldSetsSerial(std::vector<atlas::FieldSet>& localFieldSets,
+                                const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                const std::string& filePath,
+                                const std::vector<util::DateTime>& dateTimes) {
+  oops::Log::debug() << "Monio::readFieldSetsSerial()" << std::endl;
+  auto& functionSpace = localFieldSets[0][0].functionspace();
+  auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
+  int variableConvention = initialiseReadFile(grid, filePath, true);
+  // The window spans the first to the last time step requested, in any order
+  std::vector<std::size_t> timeSteps;
+  std::size_t timeStart = 0;
+  std::size_t numTimes = 0;
+  if (isMpiRankReadOwner() == true) {
+    for (const auto& dateTime : dateTimes) {
+      timeSteps.push_back(reader_.findTimeStep(filesData_.at(grid.name()), dateTime));
+    }
+    timeStart = *std::min_element(timeSteps.begin(), timeSteps.end());
+    numTimes = *std::max_element(timeSteps.begin(), timeSteps.end()) - timeStart + 1;
+  }
+  mpiCommunicator_.broadcast(variableConvention, mpiRankReadOwner_);
+  const bool isLfricConvention = variableConvention == consts::eLfricConvention;
+  // Configure read names. Fields without variables in the file are left unchanged.
+  std::vector<std::string> readNames;
+  std::vector<std::size_t> readIndices;
+  getReadNames(fieldMetadataVec, variableConvention, true, readNames, readIndices);
+  // Fields are assigned to owner PEs in turn, as for readFieldSetSerial. Each field's read data
+  // hold all of its time steps, so are scattered once for each, at that time step's offset.
+  std::size_t numReads = readIndices.size();
+  std::size_t numOwners = mpiRankReadOwners_.size();
+  std::size_t roundSize = numOwners * consts::kGatherBatchSize;
+  FileData windowFileData;
+  if (isMpiRankReadOwner() == true) {
+    windowFileData.getMetadata() = filesData_.at(grid.name()).getMetadata();
+  }
+  std::vector<std::unique_ptr<OwnerPlan>> ownerPlans =
+      createOwnerPlans(functionSpace, grid.name(), mpiRankReadOwners_);
+  for (std::size_t roundStart = 0; roundStart < numReads; roundStart += roundSize) {
+    std::size_t roundEnd = std::min(roundStart + roundSize, numReads);
+    for (std::size_t owner = 0; owner < numOwners; ++owner) {
+      std::vector<atlas::Field> localFields;
+      std::vector<consts::FieldMetadata> localFieldMetadataVec;
+      std::vector<std::shared_ptr<DataContainerBase>> dataContainers;
+      std::vector<std::size_t> levelOffsets;
+      for (std::size_t k = roundStart + owner; k < roundEnd; k += numOwners) {
+        const std::size_t i = readIndices[k];
+        const auto& fieldMetadata = fieldMetadataVec[i];
+        std::shared_ptr<DataContainerBase> dataContainer = nullptr;
+        bool isTimeVariable = false;
+        std::size_t levelsPerTime = 1;
+        if (mpiCommunicator_.rank() == mpiRankReadOwners_[owner]) {
+          const std::string& readName = readNames[i];
+          oops::Log::debug() << "Monio::readFieldSetsSerial() processing data for> \"" <<
+                                readName << "\"..." << std::endl;
+          reader_.readDatumAtTimes(windowFileData, readName, timeStart, numTimes);
+          dataContainer = windowFileData.getData().getContainer(readName);
+          windowFileData.getData().deleteContainer(readName);
+          for (const auto& dimPair :
+               windowFileData.getMetadata().getVariable(readName)->getDimensionsMap()) {
+            if (dimPair.first == consts::kTimeDimName) {
+              isTimeVariable = true;
+            } else if (dimPair.first != consts::kHorizontalName) {
+              levelsPerTime *= dimPair.second;
+            }
+          }
+        }
+        for (std::size_t t = 0; t < localFieldSets.size(); ++t) {
+          localFields.push_back(localFieldSets[t][fieldMetadata.jediName]);
+          localFieldMetadataVec.push_back(fieldMetadata);
+          if (mpiCommunicator_.rank() == mpiRankReadOwners_[owner]) {
+            dataContainers.push_back(dataContainer);
+            levelOffsets.push_back(isTimeVariable == true ?
+                                   (timeSteps[t] - timeStart) * levelsPerTime : 0);
+          }
+        }
+      }
+      atlasReader_.populateFieldsWithOwnerPlan(localFields, dataContainers, localFieldMetadataVec,
+                                               levelOffsets, isLfricConvention,
+                                               *ownerPlans[owner]);
+    }
+  }
+  // A single halo exchange for all fields of each time step. Fields share names between them.
+  for (auto& localFieldSet : localFieldSets) {
+    atlas::FieldSet haloFieldSet;
+    for (const auto& fieldMetadata : fieldMetadataVec) {
+      haloFieldSet.add(localFieldSet[fieldMetadata.jediName]);
+    }
+    functionSpace.haloExchange(haloFieldSet);
+  }
+  reader_.closeFile();
+}
+
+void monio::Monio::readFieldsStreamed(atlas::FieldSet& localFieldSet,
+                                const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                const std::vector<std::string>& readNames,
+                                const std::vector<std::size_t>& readIndices,
+                                      FileData& slabFileData,
+                                const std::vector<std::unique_ptr<OwnerPlan>>& ownerPlans,
+                                const std::size_t timeStep,
+                                const bool isLfricConvention) {
+  oops::Log::debug() << "Monio::readFieldsStreamed()" << std::endl;
+  std::size_t numOwners = mpiRankReadOwners_.size();
+  for (std::size_t k = 0; k < readIndices.size(); ++k) {
+    const std::size_t i = readIndices[k];
+    const std::string& readName = readNames[i];
+    auto& localField = localFieldSet[fieldMetadataVec[i].jediName];
+    const OwnerPlan& ownerPlan = *ownerPlans[k % numOwners];
+    const bool isOwner = mpiCommunicator_.rank() == std::size_t(ownerPlan.getMpiRankOwner());
+    if (isOwner == true) {
+      oops::Log::debug() << "Monio::readFieldsStreamed() processing data for> \"" <<
+                            readName << "\"..." << std::endl;
+    }
+    std::size_t fileLevelStart = atlasReader_.getReadLevelStart(localField, fieldMetadataVec[i],
+                                                                isLfricConvention);
+    std::size_t numLevels = localField.shape(consts::eVertical);
+    std::size_t slabLevels = getSlabLevels(ownerPlan.getGlobalSize(), numLevels);
+    for (std::size_t levelStart = 0; levelStart < numLevels; levelStart += slabLevels) {
+      std::size_t slabSize = std::min(slabLevels, numLevels - levelStart);
+      std::shared_ptr<DataContainerBase> dataContainer = nullptr;
+      if (isOwner == true) {
+        reader_.readDatumLevels(slabFileData, readName, timeStep, fileLevelStart + levelStart,
+                                slabSize);
+        dataContainer = slabFileData.getData().getContainer(readName);
+        slabFileData.getData().deleteContainer(readName);
+      }
+      atlasReader_.populateFieldLevelsWithOwnerPlan(localField, dataContainer, levelStart,
+                                                    slabSize, ownerPlan);
+    }
+  }
+}
+
+void monio::Monio::readFieldSetFromServer(atlas::FieldSet& localFieldSet,
+                                const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                const std::string& filePath,
+                                const util::DateTime& dateTime,
+                                const bool isState) {
+  oops::Log::debug() << "Monio::readFieldSetFromServer()" << std::endl;
+  auto& functionSpace = localFieldSet[0].functionspace();
+  auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
+  const eckit::mpi::Comm& serverComm = ioServer_->getServerComm(filePath);
+  const int mpiRankServer = ioServer_->getMpiRankServer();
+  IoRequest request;
+  request.type = consts::eReadRequest;
+  request.filePath = filePath;
+  request.gridName = grid.name();
+  request.dateTime = isState == true ? dateTime.toString() : "";
+  request.isState = isState;
+  request.fieldMetadataVec = fieldMetadataVec;
+  for (const auto& fieldMetadata : fieldMetadataVec) {
+    const auto& localField = localFieldSet[fieldMetadata.jediName];
+    request.varNames.push_back("");  // Read names are configured by the I/O server PE
+    request.vertConfigNames.push_back("");
+    request.numLevels.push_back(localField.shape(consts::eVertical));
+    request.dataTypes.push_back(utilsatlas::atlasTypeToMonioEnum(localField.datatype()));
+  }
+  ioServer_->broadcastRequest(serverComm, request);
+  int variableConvention = consts::eLfricConvention;
+  serverComm.broadcast(variableConvention, mpiRankServer);
+  initFilePaths_[grid.name()] = filePath;
+  std::vector<std::string> readNames;
+  std::vector<std::size_t> readIndices;
+  getReadNames(fieldMetadataVec, variableConvention, isState, readNames, readIndices);
+  // The I/O server PE packs the points of each compute PE directly from the read data
+  std::vector<size_t> localPoints;
+  std::vector<size_t> localGlobalIndices;
+  utilsatlas::getOwnedPointIndices(functionSpace, localPoints, localGlobalIndices);
+  OwnerPlan ownerPlan(serverComm, localPoints, localGlobalIndices, std::vector<size_t>(),
+                      mpiRankServer);
+  for (std::size_t batchStart = 0; batchStart < readIndices.size();
+       batchStart += consts::kGatherBatchSize) {
+    std::size_t batchEnd = std::min(batchStart + consts::kGatherBatchSize, readIndices.size());
+    std::vector<atlas::Field> localFields;
+    std::vector<consts::FieldMetadata> localFieldMetadataVec;
+    for (std::size_t k = batchStart; k < batchEnd; ++k) {
+      const auto& fieldMetadata = fieldMetadataVec[readIndices[k]];
+      localFields.push_back(localFieldSet[fieldMetadata.jediName]);
+      localFieldMetadataVec.push_back(fieldMetadata);
+    }
+    atlasReader_.populateFieldsWithOwnerPlan(localFields,
+                                             std::vector<std::shared_ptr<DataContainerBase>>(),
+                                             localFieldMetadataVec,
+                                             variableConvention == consts::eLfricConvention,
+                                             ownerPlan);
+  }
+  // A single halo exchange for all fields
+  atlas::FieldSet haloFieldSet;
+  for (const auto& fieldMetadata : fieldMetadataVec) {
+    haloFieldSet.add(localFieldSet[fieldMetadata.jediName]);
+  }
+  functionSpace.haloExchange(haloFieldSet);
+}
+
+std::future<std::shared_ptr<monio::DataContainerBase>> monio::Monio::readDatumAsync(
+                                                              FileData& prefetchFileData,
+                                                        const FileData& fileData,
+                                                        const std::string& readName,
+                                                        const std::size_t timeStep,
+                                                        const bool isState) {
+  oops::Log::debug() << "Monio::readDatumAsync()" << std::endl;
+  if (fileData.getData().isContainerPresent(readName) == true) {
+    return std::future<std::shared_ptr<DataContainerBase>>();  // Read is not required
+  }
+  return std::async(std::launch::async, [this, &prefetchFileData, readName, timeStep, isState]() {
+    if (isState == true) {
+      reader_.readDatumAtTime(prefetchFileData, readName, timeStep,
+                              std::string(consts::kTimeDimName));
+    } else {
+      reader_.readFullDatum(prefetchFileData, readName);
+    }
+    std::shared_ptr<DataContainerBase> dataContainer =
+                                            prefetchFileData.getData().getContainer(readName);
+    prefetchFileData.getData().deleteContainer(readName);
+    return dataContainer;
+  });
+}
+
+void monio::Monio::readFieldSetParallel(atlas::FieldSet& localFieldSet,
+                                        const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                        const std::string& filePath,
+                                        const util::DateTime& dateTime,
+                                        const bool isState) {
+  oops::Log::debug() << "Monio::readFieldSetParallel()" << std::endl;
+  auto& functionSpace = localFieldSet[0].functionspace();
+  auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
+  // File geometry is derived by the primary owner PE and shared with all PEs
+  int variableConvention = initialiseReadFile(grid, filePath, isState);
+  std::size_t timeStep = 0;
+  std::vector<size_t> lfricAtlasMap;
+  if (mpiCommunicator_.rank() == mpiRankReadOwner_) {
+    const FileData& fileData = filesData_.at(grid.name());
+    lfricAtlasMap = fileData.getLfricAtlasMap();
+    if (isState == true) {
+      timeStep = reader_.findTimeStep(fileData, dateTime);
+    }
+  }
+  reader_.closeFile();
+  mpiCommunicator_.broadcast(variableConvention, mpiRankReadOwner_);
+  mpiCommunicator_.broadcast(timeStep, mpiRankReadOwner_);
+  utils::broadcastVector(mpiCommunicator_, lfricAtlasMap, mpiRankReadOwner_);
+  DistributionPlan distributionPlan(mpiCommunicator_,
+                             utilsatlas::getLocalFileIndices(localFieldSet[0], lfricAtlasMap),
+                             lfricAtlasMap.size());
+  // Read file metadata is not shared, so FileData is local to this function
+  FileData fileData;
+  parallelReader_.openFile(filePath);
+  parallelReader_.readMetadata(fileData);
+  for (const auto& fieldMetadata : fieldMetadataVec) {
+    auto& localField = localFieldSet[fieldMetadata.jediName];
+    // Configure read name
+    std::string readName = fieldMetadata.lfricReadName;
+    if (variableConvention == consts::eJediConvention) {
+      readName = fieldMetadata.jediName;
+    }
+    if (isState == false || utils::findInVector(consts::kMissingVariableNames, readName) == false) {
+      oops::Log::debug() << "Monio::readFieldSetParallel() processing data for> \"" <<
+                            readName << "\"..." << std::endl;
+      // Fields without a first level skip the surface level of LFRic full-level variables
+      atlas::idx_t numLevels = localField.shape(consts::eVertical);
+      if (fieldMetadata.noFirstLevel == true && numLevels == consts::kVerticalFullSize) {
+        utils::throwException("Monio::readFieldSetParallel()> Field levels misconfiguration...");
+      }
+      std::size_t levelStart = 0;
+      if (variableConvention == consts::eLfricConvention &&
+          fieldMetadata.noFirstLevel == true && numLevels == consts::kVerticalHalfSize) {
+        levelStart = 1;
+      }
+      parallelReader_.readDatumBlock(fileData, readName, timeStep, levelStart, numLevels,
+                                     distributionPlan.getBlockStart(),
+                                     distributionPlan.getBlockSize());
+      atlasReader_.populateFieldWithBlockData(localField,
+                                              fileData.getData().getContainer(readName),
+                                              distributionPlan);
+      fileData.getData().deleteContainer(readName);
+    } else {
+      oops::Log::info() << "Monio::readFieldSetParallel()> Variable \"" + fieldMetadata.jediName +
+                           "\" not defined in LFRic. Skipping read..." << std::endl;
+    }
+  }
+  parallelReader_.closeFile();
+  // A single halo exchange for all fields
+  atlas::FieldSet haloFieldSet;
+  for (const auto& fieldMetadata : fieldMetadataVec) {
+    haloFieldSet.add(localFieldSet[fieldMetadata.jediName]);
+  }
+  functionSpace.haloExchange(haloFieldSet);
+}
+
+void monio::Monio::writeFieldSetSerial(const atlas::FieldSet& localFieldSet,
+                                       const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                       const std::string& filePath,
+                                       const bool isLfricConvention,
+                                       const bool isState) {
+  oops::Log::debug() << "Monio::writeFieldSetSerial()" << std::endl;
+  auto& functionSpace = localFieldSet[0].functionspace();
+  auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
+  initialiseWriteFile(grid);
+  FileData fileData = getFileData(grid.name());
+  cleanFileData(fileData);  // Remove metadata required for reading, but not for writing.
+  if (isLfricConvention == false) {
+    addJediData(fileData);
+  }
+  // Mesh data are written by the primary owner PE, only.
+  if (mpiCommunicator_.rank() != mpiRankWriteOwner_) {
+    fileData.clearData();
+  }
+  // A file can be open for writing on one PE at a time. Where there are multiple owner PEs, each
+  // opens and closes the file in turn. Streamed writes use the primary owner PE only.
+  bool isFileShared = mpiRankWriteOwners_.size() > 1 && memoryBudget_ == 0;
+  if (mpiCommunicator_.rank() == mpiRankWriteOwner_) {
+    writer_.openFile(filePath);
+    if (isFileShared == true) {
+      writer_.closeFile();
+    }
+  }
+  if (memoryBudget_ > 0) {
+    writeFieldSetStreamed(fileData, localFieldSet, fieldMetadataVec, isLfricConvention, isState);
+    writer_.closeFile();
+    return;
+  }
+  if (isFileShared == false) {
+    writeFieldSetPipelined(fileData, localFieldSet, fieldMetadataVec, isLfricConvention, isState);
+    writer_.closeFile();
+    return;
+  }
+  // Fields are assigned to owner PEs in turn. Each round of fields is gathered by the owner PEs,
+  // directly into LFRic order, before being written. The fields of each owner PE in a round are
+  // gathered together. Gathers are issued to one owner PE after another, and writes are
+  // serialised by the shared file, so this spreads memory use rather than speeding up the write.
+  std::vector<std::string> writeNames;
+  std::vector<std::string> verticalConfigNames;
+  getWriteNames(localFieldSet, fieldMetadataVec, isLfricConvention, isState,
+                writeNames, verticalConfigNames);
+  std::vector<std::unique_ptr<OwnerPlan>> ownerPlans =
+      createOwnerPlans(functionSpace, grid.name(), mpiRankWriteOwners_);
+  std::size_t numFields = fieldMetadataVec.size();
+  std::size_t numOwners = mpiRankWriteOwners_.size();
+  std::size_t roundSize = numOwners * consts::kGatherBatchSize;
+  for (std::size_t roundStart = 0; roundStart < numFields; roundStart += roundSize) {
+    std::size_t roundEnd = std::min(roundStart + roundSize, numFields);
+    for (std::size_t owner = 0; owner < numOwners; ++owner) {
+      std::vector<atlas::Field> ownerFields;
+      std::vector<consts::FieldMetadata> ownerFieldMetadataVec;
+      std::vector<std::string> ownerWriteNames;
+      std::vector<std::string> ownerVerticalConfigNames;
+      for (std::size_t i = roundStart + owner; i < roundEnd; i += numOwners) {
+        oops::Log::debug() << "Monio::writeFieldSetSerial() processing data for> \"" <<
+                              writeNames[i] << "\"..." << std::endl;
+        ownerFields.push_back(localFieldSet[fieldMetadataVec[i].jediName]);
+        ownerFieldMetadataVec.push_back(fieldMetadataVec[i]);
+        ownerWriteNames.push_back(writeNames[i]);
+        ownerVerticalConfigNames.push_back(verticalConfigNames[i]);
+      }
+      atlasWriter_.populateFileDataWithLocalFields(fileData, ownerFields, ownerFieldMetadataVec,
+                                                   ownerWriteNames, ownerVerticalConfigNames,
+                                                   isLfricConvention, *ownerPlans[owner]);
+    }
+    // Each owner PE writes its fields of the round in turn
+    for (std::size_t owner = 0; owner < numOwners; ++owner) {
+      if (mpiCommunicator_.rank() == mpiRankWriteOwners_[owner]) {
+        if (isFileShared == true) {
+          writer_.openFile(filePath, netCDF::NcFile::write);
+        }
+        writer_.writeMetadata(fileData.getMetadata());
+        writer_.writeData(fileData);
+        fileData.clearData();  // Written field data no longer required
+        if (isFileShared == true) {
+          writer_.closeFile();
+        }
+      }
+      if (isFileShared == true) {
+        mpiCommunicator_.barrier();  // Passes the file to the next owner PE
+      }
+    }
+  }
+  writer_.closeFile();
+}
+
+void monio::Monio::writeFieldSetPipelined(FileData& fileData,
+                                    const atlas::FieldSet& localFieldSet,
+                                    const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                    const bool isLfricConvention,
+                                    const bool isState) {
+  oops::Log::debug() << "Monio::writeFieldSetPipelined()" << std::endl;
+  std::vector<std::string> writeNames;
+  std::vector<std::string> verticalConfigNames;
+  getWriteNames(localFieldSet, fieldMetadataVec, isLfricConvention, isState,
+                writeNames, verticalConfigNames);
+  const auto& functionSpace = localFieldSet[0].functionspace();
+  const std::string& gridName =
+                        atlas::functionspace::NodeColumns(functionSpace).mesh().grid().name();
+  // Only the primary write owner PE writes, so only its plan is created
+  std::vector<std::unique_ptr<OwnerPlan>> ownerPlans =
+      createOwnerPlans(functionSpace, gridName, std::vector<std::size_t>{mpiRankWriteOwner_});
+  // Batches of fields are gathered directly into LFRic order, with the data of each PE remapped as
+  // they arrive at the owner PE. Each batch is then written on a background thread, while the
+  // next batch is gathered.
+  const bool isOwner = mpiCommunicator_.rank() == mpiRankWriteOwner_;
+  FileData baseFileData = fileData;  // Written with each batch, without mesh data
+  baseFileData.clearData();
+  bool isFirstBatch = true;
+  std::future<void> pendingWrite;
+  std::size_t numFields = fieldMetadataVec.size();
+  for (std::size_t batchStart = 0; batchStart < numFields;
+       batchStart += consts::kGatherBatchSize) {
+    std::size_t batchEnd = std::min(batchStart + consts::kGatherBatchSize, numFields);
+    std::vector<atlas::Field> localFields;
+    for (std::size_t i = batchStart; i < batchEnd; ++i) {
+      oops::Log::debug() << "Monio::writeFieldSetPipelined() processing data for> \"" <<
+                            writeNames[i] << "\"..." << std::endl;
+      localFields.push_back(localFieldSet[fieldMetadataVec[i].jediName]);
+    }
+    FileData batchFileData = isFirstBatch == true ? std::move(fileData) : baseFileData;
+    isFirstBatch = false;
+    atlasWriter_.populateFileDataWithLocalFields(batchFileData, localFields,
+        std::vector<consts::FieldMetadata>(fieldMetadataVec.begin() + batchStart,
+                                           fieldMetadataVec.begin() + batchEnd),
+        std::vector<std::string>(writeNames.begin() + batchStart, writeNames.begin() + batchEnd),
+        std::vector<std::string>(verticalConfigNames.begin() + batchStart,
+                                 verticalConfigNames.begin() + batchEnd),
+        isLfricConvention, *ownerPlans.front());
+    if (isOwner == true) {
+      if (pendingWrite.valid() == true) {
+        pendingWrite.get();
+      }
+      pendingWrite = std::async(std::launch::async, [this](FileData batchFileData) {
+        writer_.writeMetadata(batchFileData.getMetadata());
+        writer_.writeData(batchFileData);
+      }, std::move(batchFileData));
+    }
+  }
+  if (pendingWrite.valid() == true) {
+    pendingWrite.get();
+  }
+}
+
+void monio::Monio::writeFieldSetStreamed(FileData& fileData,
+                                   const atlas::FieldSet& localFieldSet,
+                                   const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                   const bool isLfricConvention,
+                                   const bool isState) {
+  oops::Log::debug() << "Monio::writeFieldSetStreamed()" << std::endl;
+  std::vector<std::string> writeNames;
+  std::vector<std::string> verticalConfigNames;
+  getWriteNames(localFieldSet, fieldMetadataVec, isLfricConvention, isState,
+                writeNames, verticalConfigNames);
+  const auto& functionSpace = localFieldSet[0].functionspace();
+  const std::string& gridName =
+                        atlas::functionspace::NodeColumns(functionSpace).mesh().grid().name();
+  // Only the primary write owner PE writes, so only its plan is created
+  std::vector<std::unique_ptr<OwnerPlan>> ownerPlans =
+      createOwnerPlans(functionSpace, gridName, std::vector<std::size_t>{mpiRankWriteOwner_});
+  const OwnerPlan& ownerPlan = *ownerPlans.front();
+  const bool isOwner = mpiCommunicator_.rank() == mpiRankWriteOwner_;
+  // Mesh data are written first. Each field's variable is then defined, before its levels are
+  // gathered and written in slabs.
+  if (isOwner == true) {
+    writer_.writeMetadata(fileData.getMetadata());
+    writer_.writeData(fileData);
+    fileData.clearData();
+  }
+  for (std::size_t i = 0; i < fieldMetadataVec.size(); ++i) {
+    const auto& fieldMetadata = fieldMetadataVec[i];
+    const auto& localField = localFieldSet[fieldMetadata.jediName];
+    oops::Log::debug() << "Monio::writeFieldSetStreamed() processing data for> \"" <<
+                          writeNames[i] << "\"..." << std::endl;
+    atlas::idx_t writeLevels = atlasWriter_.getWriteLevels(localField, writeNames[i],
+                                                           fieldMetadata.noFirstLevel,
+                                                           isLfricConvention);
+    if (isOwner == true) {
+      atlasWriter_.populateMetadataWithLocalField(fileData.getMetadata(), localField,
+                                                  fieldMetadata, writeNames[i],
+                                                  verticalConfigNames[i], isLfricConvention);
+      writer_.writeMetadata(fileData.getMetadata());
+    }
+    std::size_t slabLevels = getSlabLevels(ownerPlan.getGlobalSize(), writeLevels);
+    for (std::size_t levelStart = 0; levelStart < std::size_t(writeLevels);
+         levelStart += slabLevels) {
+      std::size_t slabSize = std::min(slabLevels, std::size_t(writeLevels) - levelStart);
+      std::shared_ptr<DataContainerBase> dataContainer = nullptr;
+      atlasWriter_.populateDataContainerWithLocalField(dataContainer, localField,
+                                             utilsatlas::getFileDataType(localField, fieldMetadata),
+                                             writeNames[i], writeLevels, levelStart, slabSize,
+                                             ownerPlan);
+      if (isOwner == true) {
+        writer_.writeDatumLevels(dataContainer, levelStart, slabSize);
+      }
+    }
+  }
+}
+
+void monio::Monio::writeFieldSetAsync(const atlas::FieldSet& localFieldSet,
+                                      const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                      const std::string& filePath,
+                                      const bool isLfricConvention,
+                                      const bool isState) {
+  oops::Log::debug() << "Monio::writeFieldSetAsync()" << std::endl;
+  auto& functionSpace = localFieldSet[0].functionspace();
+  auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
+  initialiseWriteFile(grid);
+  FileData fileData = getFileData(grid.name());
+  cleanFileData(fileData);  // Remove metadata required for reading, but not for writing.
+  if (isLfricConvention == false) {
+    addJediData(fileData);
+  }
+  // Configure write names before handing off, so that errors are raised in the calling thread
+  std::vector<std::string> writeNames;
+  std::vector<std::string> verticalConfigNames;
+  getWriteNames(localFieldSet, fieldMetadataVec, isLfricConvention, isState,
+                writeNames, verticalConfigNames);
+  // Batches of fields are gathered to the primary write owner PE, directly into LFRic order. This
+  // is the only communication required, so other PEs return once it completes. Only the gathered
+  // file data are handed to the background thread, which writes them.
+  std::vector<std::unique_ptr<OwnerPlan>> ownerPlans =
+      createOwnerPlans(functionSpace, grid.name(), std::vector<std::size_t>{mpiRankWriteOwner_});
+  const bool isOwner = mpiCommunicator_.rank() == mpiRankWriteOwner_;
+  FileData baseFileData = fileData;  // Written with each batch, without mesh data
+  baseFileData.clearData();
+  std::vector<FileData> batchFileDataVec;
+  std::size_t numFields = fieldMetadataVec.size();
+  for (std::size_t batchStart = 0; batchStart < numFields;
+       batchStart += consts::kGatherBatchSize) {
+    std::size_t batchEnd = std::min(batchStart + consts::kGatherBatchSize, numFields);
+    std::vector<atlas::Field> localFields;
+    for (std::size_t i = batchStart; i < batchEnd; ++i) {
+      oops::Log::debug() << "Monio::writeFieldSetAsync() processing data for> \"" <<
+                            writeNames[i] << "\"..." << std::endl;
+      localFields.push_back(localFieldSet[fieldMetadataVec[i].jediName]);
+    }
+    FileData batchFileData = batchStart == 0 ? std::move(fileData) : baseFileData;
+    atlasWriter_.populateFileDataWithLocalFields(batchFileData, localFields,
+        std::vector<consts::FieldMetadata>(fieldMetadataVec.begin() + batchStart,
+                                           fieldMetadataVec.begin() + batchEnd),
+        std::vector<std::string>(writeNames.begin() + batchStart, writeNames.begin() + batchEnd),
+        std::vector<std::string>(verticalConfigNames.begin() + batchStart,
+                                 verticalConfigNames.begin() + batchEnd),
+        isLfricConvention, *ownerPlans.front());
+    if (isOwner == true) {
+      batchFileDataVec.push_back(std::move(batchFileData));
+    }
+  }
+  // Writing is handed to a background thread on the primary write owner PE
+  pendingWritePath_ = filePath;
+  if (isOwner == true) {
+    pendingWrite_ = std::async(std::launch::async,
+        [this, batchFileDataVec = std::move(batchFileDataVec), filePath]() mutable {
+      // Errors are raised by flush, on the calling thread
+      utils::setBackgroundThread(true);
+      writer_.openFile(filePath);
+      for (auto& batchFileData : batchFileDataVec) {
+        writer_.writeMetadata(batchFileData.getMetadata());
+        writer_.writeData(batchFileData);
+        batchFileData = FileData();  // Written field data no longer required
+      }
+      writer_.closeFile();
+    });
+  }
+}
+
+void monio::Monio::writeFieldSetToServer(const atlas::FieldSet& localFieldSet,
+                                         const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                         const std::string& filePath,
+                                         const bool isLfricConvention,
+                                         const bool isState) {
+  oops::Log::debug() << "Monio::writeFieldSetToServer()" << std::endl;
+  auto& functionSpace = localFieldSet[0].functionspace();
+  auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
+  auto it = initFilePaths_.find(grid.name());
+  if (it == initFilePaths_.end()) {
+    Monio::get().closeFiles();
+    utils::throwException("Monio::writeFieldSetToServer()> File data for grid \"" + grid.name() +
+                          "\" have not been initialised...");
+  }
+  std::vector<std::string> writeNames;
+  std::vector<std::string> verticalConfigNames;
+  getWriteNames(localFieldSet, fieldMetadataVec, isLfricConvention, isState,
+                writeNames, verticalConfigNames);
+  const eckit::mpi::Comm& serverComm = ioServer_->getServerComm(filePath);
+  const int mpiRankServer = ioServer_->getMpiRankServer();
+  IoRequest request;
+  request.type = consts::eWriteRequest;
+  request.filePath = filePath;
+  request.gridName = grid.name();
+  request.initFilePath = it->second;
+  request.isState = isState;
+  request.isLfricConvention = isLfricConvention;
+  request.fieldMetadataVec = fieldMetadataVec;
+  request.varNames = writeNames;
+  request.vertConfigNames = verticalConfigNames;
+  for (std::size_t i = 0; i < fieldMetadataVec.size(); ++i) {
+    const auto& localField = localFieldSet[fieldMetadataVec[i].jediName];
+    request.numLevels.push_back(atlasWriter_.getWriteLevels(localField, writeNames[i],
+                                                            fieldMetadataVec[i].noFirstLevel,
+                                                            isLfricConvention));
+    request.dataTypes.push_back(utilsatlas::getFileDataType(localField, fieldMetadataVec[i]));
+  }
+  ioServer_->broadcastRequest(serverComm, request);
+  // Batches of fields are gathered directly into LFRic order on the I/O server PE. The file is
+  // written once all are gathered, so that compute PEs return without waiting for it.
+  std::vector<size_t> localPoints;
+  std::vector<size_t> localGlobalIndices;
+  utilsatlas::getOwnedPointIndices(functionSpace, localPoints, localGlobalIndices);
+  OwnerPlan ownerPlan(serverComm, localPoints, localGlobalIndices, std::vector<size_t>(),
+                      mpiRankServer);
+  FileData fileData;  // Populated on the I/O server PE only
+  std::size_t numFields = fieldMetadataVec.size();
+  for (std::size_t batchStart = 0; batchStart < numFields;
+       batchStart += consts::kGatherBatchSize) {
+    std::size_t batchEnd = std::min(batchStart + consts::kGatherBatchSize, numFields);
+    std::vector<atlas::Field> localFields;
+    for (std::size_t i = batchStart; i < batchEnd; ++i) {
+      localFields.push_back(localFieldSet[fieldMetadataVec[i].jediName]);
+    }
+    atlasWriter_.populateFileDataWithLocalFields(fileData, localFields,
+        std::vector<consts::FieldMetadata>(fieldMetadataVec.begin() + batchStart,
+                                           fieldMetadataVec.begin() + batchEnd),
+        std::vector<std::string>(writeNames.begin() + batchStart, writeNames.begin() + batchEnd),
+        std::vector<std::string>(verticalConfigNames.begin() + batchStart,
+                                 verticalConfigNames.begin() + batchEnd),
+        isLfricConvention, ownerPlan);
+  }
+}
+
+void monio::Monio::serveRequests(const IoServer& ioServer) {
+  oops::Log::debug() << "Monio::serveRequests()" << std::endl;
+  const eckit::mpi::Comm& serverComm = ioServer.getServerComm();
+  const int mpiRankServer = ioServer.getMpiRankServer();
+  IoRequest request;
+  do {
+    ioServer.broadcastRequest(serverComm, request);
+    try {
+      switch (request.type) {
+        case consts::eInitialiseRequest:
+          serveInitialiseRequest(serverComm, mpiRankServer, request);
+          break;
+        case consts::eReadRequest:
+          serveReadRequest(serverComm, mpiRankServer, request);
+          break;
+        case consts::eWriteRequest:
+          serveWriteRequest(serverComm, mpiRankServer, request);
+          break;
+        case consts::eStopRequest:
+          break;
+        default:
+          Monio::get().closeFiles();
+          utils::throwException("Monio::serveRequests()> Request type not recognised...");
+      }
+    } catch (netCDF::exceptions::NcException& exception) {
+      Monio::get().closeFiles();
+      std::string exceptionMessage = exception.what();
+      utils::throwException("Monio::serveRequests()> An exception has occurred: " +
+                            exceptionMessage);
+    }
+  } while (request.type != consts::eStopRequest);
+  closeFiles();
+  serverComm.barrier();  // Signals completion of all requests to the compute PEs
+}
+
+void monio::Monio::serveInitialiseRequest(const eckit::mpi::Comm& serverComm,
+                                          const int mpiRankServer,
+                                          const IoRequest& request) {
+  oops::Log::debug() << "Monio::serveInitialiseRequest()" << std::endl;
+  int variableConvention = initialiseFile(atlas::Grid(request.gridName), request.filePath,
+                                          request.isState);
+  reader_.closeFile();
+  serverComm.broadcast(variableConvention, mpiRankServer);
+}
+
+void monio::Monio::serveReadRequest(const eckit::mpi::Comm& serverComm,
+                                    const int mpiRankServer,
+                                    const IoRequest& request) {
+  oops::Log::debug() << "Monio::serveReadRequest()" << std::endl;
+  int variableConvention = initialiseFile(atlas::Grid(request.gridName), request.filePath,
+                                          request.isState);
+  FileData& fileData = filesData_.at(request.gridName);
+  std::size_t timeStep = 0;
+  if (request.isState == true) {
+    timeStep = reader_.findTimeStep(fileData, util::DateTime(request.dateTime));
+  }
+  serverComm.broadcast(variableConvention, mpiRankServer);
+  const bool isLfricConvention = variableConvention == consts::eLfricConvention;
+  std::vector<std::string> readNames;
+  std::vector<std::size_t> readIndices;
+  getReadNames(request.fieldMetadataVec, variableConvention, request.isState,
+               readNames, readIndices);
+  const std::vector<size_t> noPoints;  // I/O server PEs own no points of the fields
+  OwnerPlan ownerPlan(serverComm, noPoints, noPoints, fileData.getLfricAtlasMap(), mpiRankServer);
+  FileData prefetchFileData;
+  prefetchFileData.getMetadata() = fileData.getMetadata();
+  for (std::size_t batchStart = 0; batchStart < readIndices.size();
+       batchStart += consts::kGatherBatchSize) {
+    std::size_t batchEnd = std::min(batchStart + consts::kGatherBatchSize, readIndices.size());
+    std::vector<std::shared_ptr<DataContainerBase>> dataContainers;
+    std::vector<std::size_t> levelStarts;
+    std::vector<std::size_t> numLevels;
+    for (std::size_t k = batchStart; k < batchEnd; ++k) {
+      const std::size_t i = readIndices[k];
+      oops::Log::debug() << "Monio::serveReadRequest() processing data for> \"" <<
+                            readNames[i] << "\"..." << std::endl;
+      // Data held as part of the file's initialisation data are not read again
+      std::future<std::shared_ptr<DataContainerBase>> pendingRead =
+          readDatumAsync(prefetchFileData, fileData, readNames[i], timeStep, request.isState);
+      dataContainers.push_back(pendingRead.valid() == true ? pendingRead.get() :
+                                           fileData.getData().getContainer(readNames[i]));
+      levelStarts.push_back(atlasReader_.getReadLevelStart(request.numLevels[i],
+                                                           request.fieldMetadataVec[i],
+                                                           isLfricConvention));
+      numLevels.push_back(request.numLevels[i]);
+    }
+    atlasReader_.scatterDataContainers(dataContainers, levelStarts, numLevels, ownerPlan,
+        [](const std::size_t, const std::size_t, const std::shared_ptr<DataContainerBase>&) {});
+  }
+  reader_.closeFile();
+}
+
+void monio::Monio::serveWriteRequest(const eckit::mpi::Comm& serverComm,
+                                     const int mpiRankServer,
+                                     const IoRequest& request) {
+  oops::Log::debug() << "Monio::serveWriteRequest()" << std::endl;
+  initialiseFile(atlas::Grid(request.gridName), request.initFilePath, false);
+  reader_.closeFile();
+  FileData fileData = getFileData(request.gridName);
+  cleanFileData(fileData);  // Remove metadata required for reading, but not for writing.
+  if (request.isLfricConvention == false) {
+    addJediData(fileData);
+  }
+  const std::vector<size_t> noPoints;  // I/O server PEs own no points of the fields
+  OwnerPlan ownerPlan(serverComm, noPoints, noPoints,
+                      filesData_.at(request.gridName).getLfricAtlasMap(), mpiRankServer);
+  std::size_t numFields = request.fieldMetadataVec.size();
+  for (std::size_t batchStart = 0; batchStart < numFields;
+       batchStart += consts::kGatherBatchSize) {
+    std::size_t batchEnd = std::min(batchStart + consts::kGatherBatchSize, numFields);
+    atlasWriter_.populateFileDataWithLocalData(fileData,
+        [](const std::size_t, const std::size_t, const std::shared_ptr<DataContainerBase>&) {},
+        std::vector<int>(request.dataTypes.begin() + batchStart,
+                         request.dataTypes.begin() + batchEnd),
+        std::vector<atlas::idx_t>(request.numLevels.begin() + batchStart,
+                                  request.numLevels.begin() + batchEnd),
+        std::vector<consts::FieldMetadata>(request.fieldMetadataVec.begin() + batchStart,
+                                           request.fieldMetadataVec.begin() + batchEnd),
+        std::vector<std::string>(request.varNames.begin() + batchStart,
+                                 request.varNames.begin() + batchEnd),
+        std::vector<std::string>(request.vertConfigNames.begin() + batchStart,
+                                 request.vertConfigNames.begin() + batchEnd),
+        request.isLfricConvention, ownerPlan);
+  }
+  writer_.openFile(request.filePath);
+  writer_.writeMetadata(fileData.getMetadata());
+  writer_.writeData(fileData);
+  writer_.closeFile();
+}
+
+void monio::Monio::writeFieldSetParallel(const atlas::FieldSet& localFieldSet,
+                                         const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                         const std::string& filePath,
+                                         const bool isLfricConvention,
+                                         const bool isState) {
+  oops::Log::debug() << "Monio::writeFieldSetParallel()" << std::endl;
+  auto& functionSpace = localFieldSet[0].functionspace();
+  auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
+  initialiseWriteFile(grid);
+  FileData fileData = getFileData(grid.name());
+  cleanFileData(fileData);  // Remove metadata required for reading, but not for writing.
+  if (isLfricConvention == false) {
+    addJediData(fileData);
+  }
+  // Configure write names and create metadata for all fields before the file is created
+  std::vector<std::string> writeNames;
+  std::vector<std::string> verticalConfigNames;
+  getWriteNames(localFieldSet, fieldMetadataVec, isLfricConvention, isState,
+                writeNames, verticalConfigNames);
+  for (std::size_t i = 0; i < fieldMetadataVec.size(); ++i) {
+    atlasWriter_.populateMetadataWithLocalField(fileData.getMetadata(),
+                                                localFieldSet[fieldMetadataVec[i].jediName],
+                                                fieldMetadataVec[i], writeNames[i],
+                                                verticalConfigNames[i], isLfricConvention);
+  }
+  // The primary owner PE writes all metadata and mesh data
+  if (mpiCommunicator_.rank() == mpiRankWriteOwner_) {
+    writer_.openFile(filePath);
+    writer_.writeMetadata(fileData.getMetadata());
+    writer_.writeData(fileData);
+    writer_.closeFile();
+  }
+  // Completion of the broadcast ensures the file is closed by the owner PE before it is reopened
+  std::vector<size_t> lfricAtlasMap = fileData.getLfricAtlasMap();
+  utils::broadcastVector(mpiCommunicator_, lfricAtlasMap, mpiRankWriteOwner_);
+  DistributionPlan distributionPlan(mpiCommunicator_,
+                             utilsatlas::getLocalFileIndices(localFieldSet[0], lfricAtlasMap),
+                             lfricAtlasMap.size());
+  parallelWriter_.openFile(filePath);
+  for (std::size_t i = 0; i < fieldMetadataVec.size(); ++i) {
+    oops::Log::debug() << "Monio::writeFieldSetParallel() processing data for> \"" <<
+                          writeNames[i] << "\"..." << std::endl;
+    const auto& localField = localFieldSet[fieldMetadataVec[i].jediName];
+    std::shared_ptr<DataContainerBase> dataContainer = nullptr;
+    atlasWriter_.populateBlockDataWithField(dataContainer, localField, fieldMetadataVec[i],
+                                            writeNames[i], isLfricConvention, distributionPlan);
+    parallelWriter_.writeDatumBlock(dataContainer, distributionPlan.getBlockStart(),
+                                    distributionPlan.getBlockSize());
+  }
+  parallelWriter_.closeFile();
+}
+
+bool monio::Monio::isMpiRankOwner() const {
+  return isMpiRankReadOwner() == true || isMpiRankWriteOwner() == true;
+}
+
+bool monio::Monio::isMpiRankReadOwner() const {
+  return std::find(mpiRankReadOwners_.begin(), mpiRankReadOwners_.end(),
+                   mpiCommunicator_.rank()) != mpiRankReadOwners_.end();
+}
+
+bool monio::Monio::isMpiRankWriteOwner() const {
+  return std::find(mpiRankWriteOwners_.begin(), mpiRankWriteOwners_.end(),
+                   mpiCommunicator_.rank()) != mpiRankWriteOwners_.end();
+}
+
+void monio::Monio::getReadNames(const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                const int variableConvention,
+                                const bool isState,
+                                      std::vector<std::string>& readNames,
+                                      std::vector<std::size_t>& readIndices) const {
+  oops::Log::debug() << "Monio::getReadNames()" << std::endl;
+  readNames.assign(fieldMetadataVec.size(), "");
+  readIndices.clear();
+  for (std::size_t i = 0; i < fieldMetadataVec.size(); ++i) {
+    const auto& fieldMetadata = fieldMetadataVec[i];
+    readNames[i] = variableConvention == consts::eJediConvention ? fieldMetadata.jediName :
+                                                                    fieldMetadata.lfricReadName;
+    if (isState == false ||
+        utils::findInVector(consts::kMissingVariableNames, readNames[i]) == false) {
+      readIndices.push_back(i);
+    } else if (mpiCommunicator_.rank() == mpiRankReadOwner_) {
+      oops::Log::info() << "Monio::getReadNames()> Variable \"" + fieldMetadata.jediName +
+                           "\" not defined in LFRic. Skipping read..." << std::endl;
+    }
+  }
+}
+
+void monio::Monio::getWriteNames(const atlas::FieldSet& localFieldSet,
+                                 const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                 const bool isLfricConvention,
+                                 const bool isState,
+                                       std::vector<std::string>& writeNames,
+                                       std::vector<std::string>& verticalConfigNames) const {
+  oops::Log::debug() << "Monio::getWriteNames()" << std::endl;
+  writeNames.clear();
+  verticalConfigNames.clear();
+  for (const auto& fieldMetadata : fieldMetadataVec) {
+    const auto& localField = localFieldSet[fieldMetadata.jediName];
+    if (isLfricConvention == true) {
+      writeNames.push_back(isState == true ? fieldMetadata.lfricReadName :
+                                             fieldMetadata.lfricWriteName);
+      verticalConfigNames.push_back(fieldMetadata.lfricVertConfig);
+    } else if (isLfricConvention == false && fieldMetadata.jediName == localField.name()) {
+      writeNames.push_back(fieldMetadata.jediName);
+      verticalConfigNames.push_back(fieldMetadata.jediVertConfig);
+    } else {
+      Monio::get().closeFiles();
+      utils::throwException("Monio::getWriteNames()> Field metadata configuration error...");
+    }
+  }
+}
+
+std::vector<std::unique_ptr<monio::OwnerPlan>> monio::Monio::createOwnerPlans(
+                                                    const atlas::FunctionSpace& functionSpace,
+                                                    const std::string& gridName,
+                                                    const std::vector<std::size_t>& mpiRankOwners) {
+  oops::Log::debug() << "Monio::createOwnerPlans()" << std::endl;
+  std::vector<size_t> localPoints;
+  std::vector<size_t> localGlobalIndices;
+  utilsatlas::getOwnedPointIndices(functionSpace, localPoints, localGlobalIndices);
+  if (std::find(mpiRankOwners.begin(), mpiRankOwners.end(),
+                mpiCommunicator_.rank()) != mpiRankOwners.end() &&
+      filesData_.find(gridName) == filesData_.end()) {
+    Monio::get().closeFiles();
+    utils::throwException("Monio::createOwnerPlans()> File data for grid \"" + gridName +
+                          "\" have not been initialised...");
+  }
+  const std::vector<size_t> emptyMap;  // The LFRic-Atlas map is only required on the owner PE
+  std::vector<std::unique_ptr<OwnerPlan>> ownerPlans;
+  for (const std::size_t mpiRankOwner : mpiRankOwners) {
+    const std::vector<size_t>& lfricAtlasMap = mpiCommunicator_.rank() == mpiRankOwner ?
+                                      filesData_.at(gridName).getLfricAtlasMap() : emptyMap;
+    ownerPlans.push_back(std::make_unique<OwnerPlan>(mpiCommunicator_, localPoints,
+                                                     localGlobalIndices, lfricAtlasMap,
+                                                     mpiRankOwner, isNodeAware_));
+  }
+  return ownerPlans;
+}
+
+std::size_t monio::Monio::getSlabLevels(const std::size_t globalSize,
+                                        const std::size_t numLevels) const {
+  if (memoryBudget_ == 0 || numLevels == 0) {
+    return numLevels;
+  }
+  // Each level is held by an owner PE as read or written, and as packed for communication, in the
+  // file's type of up to double precision
+  std::size_t levelSize = std::max(globalSize, std::size_t(1)) * 2 * sizeof(double);
+  return std::clamp(memoryBudget_ / levelSize, std::size_t(1), numLevels);
+}
+
 monio::FileData& monio::Monio::createFileData(const std::string& gridName,
                                               const std::string& filePath) {
   oops::Log::debug() << "Monio::createFileData()" << std::endl;
@@ -386,16 +1656,63 @@ monio::FileData monio::Monio::getFileData(const std::string& gridName) {
   return FileData();  // This function is called by all PEs. A return is essential.
 }
 
-void monio::Monio::createLfricAtlasMap(FileData& fileData, const atlas::CubedSphereGrid& grid) {
+void monio::Monio::createLfricAtlasMap(FileData& fileData,
+                                 const atlas::CubedSphereGrid& grid,
+                                       FileData& previousFileData) {
   oops::Log::debug() << "Monio::createLfricAtlasMap()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (isMpiRankOwner() == true) {
     if (fileData.getLfricAtlasMap().size() == 0) {
       reader_.readFullData(fileData, consts::kLfricCoordVarNames);
       std::vector<std::shared_ptr<monio::DataContainerBase>> coordData =
                                 reader_.getCoordData(fileData, consts::kLfricCoordVarNames);
       std::vector<atlas::PointLonLat> lfricCoords = utilsatlas::getLfricCoords(coordData);
+      // Where the mesh is unchanged from the previous file, its map is reused
+      if (previousFileData.getLfricAtlasMap().size() == lfricCoords.size()) {
+        std::vector<std::shared_ptr<monio::DataContainerBase>> previousCoordData =
+                          reader_.getCoordData(previousFileData, consts::kLfricCoordVarNames);
+        if (previousCoordData.size() == coordData.size()) {
+          std::vector<atlas::PointLonLat> previousCoords =
+                                                  utilsatlas::getLfricCoords(previousCoordData);
+          if (std::equal(lfricCoords.begin(), lfricCoords.end(), previousCoords.begin(),
+                         [](const atlas::PointLonLat& a, const atlas::PointLonLat& b) {
+                           return a.lon() == b.lon() && a.lat() == b.lat();
+                         })) {
+            oops::Log::debug() << "Monio::createLfricAtlasMap()> Mesh unchanged. "
+                                  "Reusing map..." << std::endl;
+            fileData.setLfricAtlasMap(std::move(previousFileData.getLfricAtlasMap()));
+            return;
+          }
+        }
+      }
+      // Where a cache directory is set, a map previously created for this mesh is read from it
+      std::string cachePath;
+      std::uint64_t coordsHash = 0;
+      if (lfricAtlasMapCacheDir_.size() != 0) {
+        coordsHash = utilsatlas::hashCoords(lfricCoords);
+        cachePath = utilsatlas::getLfricAtlasMapCachePath(lfricAtlasMapCacheDir_, grid.name(),
+                                                          lfricCoords.size(), coordsHash);
+        std::vector<size_t> lfricAtlasMap = utilsatlas::readLfricAtlasMap(cachePath, grid.name(),
+                                                               lfricCoords.size(), coordsHash);
+        if (lfricAtlasMap.size() != 0 && remap::isPermutation(lfricAtlasMap) == true) {
+          oops::Log::debug() << "Monio::createLfricAtlasMap()> Map read from \"" <<
+                                cachePath << "\"..." << std::endl;
+          fileData.setLfricAtlasMap(std::move(lfricAtlasMap));
+          return;
+        }
+      }
+      // Maps are validated once here, so that remapping need not check each index of each field
       std::vector<atlas::PointLonLat> atlasCoords = utilsatlas::getAtlasCoords(grid);
       fileData.setLfricAtlasMap(utilsatlas::createLfricAtlasMap(atlasCoords, lfricCoords));
+      if (remap::isPermutation(fileData.getLfricAtlasMap()) == false) {
+        Monio::get().closeFiles();
+        utils::throwException("Monio::createLfricAtlasMap()> Map between LFRic and Atlas points "
+                              "is not one-to-one...");
+      }
+      if (cachePath.size() != 0 && utilsatlas::writeLfricAtlasMap(cachePath, grid.name(),
+                                            coordsHash, fileData.getLfricAtlasMap()) == false) {
+        oops::Log::info() << "Monio::createLfricAtlasMap()> Unable to write map cache \"" <<
+                             cachePath << "\"..." << std::endl;
+      }
     }
   }
 }
@@ -404,7 +1721,7 @@ void monio::Monio::createDateTimes(FileData& fileData,
                              const std::string& timeVarName,
                              const std::string& timeOriginName) {
   oops::Log::debug() << "Monio::createDateTimes()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (isMpiRankOwner() == true) {
     if (fileData.getDateTimes().size() == 0) {
       std::shared_ptr<Variable> timeVar = fileData.getMetadata().getVariable(timeVarName);
       std::shared_ptr<DataContainerBase> timeDataBase =
@@ -437,7 +1754,7 @@ void monio::Monio::createDateTimes(FileData& fileData,
 
 void monio::Monio::cleanFileData(FileData& fileData) {
   oops::Log::debug() << "Monio::cleanFileData()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (isMpiRankOwner() == true) {
     fileData.getMetadata().clearGlobalAttributes();
     fileData.getMetadata().deleteDimension(std::string(consts::kTimeDimName));
     fileData.getMetadata().deleteDimension(std::string(consts::kTileDimName));
@@ -8,6 +8,7 @@
 ******************************************************************************/
 #pragma once
 
+#include <future>  // NOLINT(build/c++11)
 #include <map>
 #include <memory>
 #include <string>
@@ -17,7 +18,12 @@
 #include "AtlasReader.h"
 #include "AtlasWriter.h"
 #include "FileData.h"
+#include "IoServer.h"
+#include "OwnerPlan.h"
+#include "ParallelReader.h"
+#include "ParallelWriter.h"
 #include "Reader.h"
+#include "ThreadPool.h"
 #include "Writer.h"
 
 namespace monio {
@@ -25,6 +31,9 @@ namespace monio {
 ///        that are written for use in debugging and testing only. All are available via a global,
 ///        singleton instance of this class.
 class Monio {
+  /// \brief Sessions hold files open for reading via the private functions of this class.
+  friend class Session;
+
  public:
   /// \brief The main singleton getter for Monio.
   static Monio& get();
@@ -37,38 +46,119 @@ class Monio {
   Monio& operator=(Monio&&)      = delete;  //!< Deleted move assignment
   Monio& operator=(const Monio&) = delete;  //!< Deleted copy assignment
 
-  /// \brief Reads files with a time component, i.e. state files.
+  /// \brief Starts I/O server PEs. The last numServerRanks PEs of the communicator become I/O
+  ///        servers, and read and write files on behalf of the others, the compute PEs. Must be
+  ///        called by all PEs before any other use of MONIO, and before Atlas objects are created.
+  ///        On compute PEs, the default communicator is set to one of the compute PEs only, and
+  ///        true is returned. On I/O server PEs, requests are handled until stopIoServer is called
+  ///        by the compute PEs, and false is returned.
+  static bool startIoServer(const int numServerRanks);
+
+  /// \brief Stops the I/O server PEs, once all requests made to them are complete. Must be called
+  ///        by all compute PEs.
+  void stopIoServer();
+
+  /// \brief Reads files with a time component, i.e. state files. The read mode selects serial
+  ///        reading by a single PE, or collective reading by all PEs (see consts::eReadModes).
   void readState(atlas::FieldSet& localFieldSet,
            const std::vector<consts::FieldMetadata>& fieldMetadataVec,
            const std::string& filePath,
-           const util::DateTime& dateTime);
+           const util::DateTime& dateTime,
+           const int readMode = consts::eSerialRead);
 
-  /// \brief Reads files without a time component, i.e. increment files.
+  /// \brief Reads a window of time steps of a state file into a field set per date-time. Each
+  ///        variable is read by an owner PE with a single read, spanning the window's first to last
+  ///        time step, and the fields of all of its time steps are scattered together. Reads via an
+  ///        I/O server, or within a memory budget (see setMemoryBudget), read each time in turn.
+  void readStates(std::vector<atlas::FieldSet>& localFieldSets,
+            const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+            const std::string& filePath,
+            const std::vector<util::DateTime>& dateTimes);
+
+  /// \brief Reads files without a time component, i.e. increment files. The read mode selects
+  ///        serial reading by a single PE, or collective reading by all PEs.
   void readIncrements(atlas::FieldSet& localFieldSet,
                 const std::vector<consts::FieldMetadata>& fieldMetadataVec,
-                const std::string& filePath);
+                const std::string& filePath,
+                const int readMode = consts::eSerialRead);
 
   /// \brief Writes increment files. No time component but the variables can use JEDI or LFRic write
-  ///        names.
+  ///        names. The write mode selects serial writing by a single PE, or collective writing by
+  ///        all PEs (see consts::eWriteModes).
   void writeIncrements(const atlas::FieldSet& localFieldSet,
                        const std::vector<consts::FieldMetadata>& fieldMetadataVec,
                        const std::string& filePath,
-                       const bool isLfricConvention = true);
+                       const bool isLfricConvention = true,
+                       const int writeMode = consts::eSerialWrite);
 
   /// \brief Writes increment files. No time component but the variables can use JEDI or LFRic read
   ///        names. Intended debugging and testing only.
   void writeState(const atlas::FieldSet& localFieldSet,
                   const std::vector<consts::FieldMetadata>& fieldMetadataVec,
                   const std::string& filePath,
-                  const bool isLfricConvention = true);
+                  const bool isLfricConvention = true,
+                  const int writeMode = consts::eSerialWrite);
 
   /// \brief Writes an field set to file. Intended debugging and testing only.
   void writeFieldSet(const atlas::FieldSet& localFieldSet,
                      const std::string& filePath);
 
+  /// \brief Sets the PE ranks used to handle MONIO I/O. Fields are assigned to each in turn, so
+  ///        that reading, remapping and scattering of different fields happen at the same time.
+  ///        Writes are not sped up: owner PEs gather in turn, then write the file in turn, so
+  ///        multiple write owner PEs only spread memory use. The first rank is the primary owner,
+  ///        used where a single PE is required.
+  ///        Must be called by all PEs with the same ranks. Clears file data, so files must be
+  ///        reinitialised before writing.
+  void setMpiRankOwners(const std::vector<int>& mpiRankOwners);
+
+  /// \brief Sets the PE ranks used to handle MONIO reads and writes independently. Write owner PEs
+  ///        that are not read owner PEs initialise themselves, when writing, from the file last
+  ///        initialised for reading. Where the two are disjoint, an asynchronous write (see
+  ///        consts::eAsyncWrite) continues on the write owner PEs during subsequent reads of other
+  ///        files, e.g. the next cycle's background whilst the previous cycle's output is written.
+  void setMpiRankOwners(const std::vector<int>& mpiRankReadOwners,
+                        const std::vector<int>& mpiRankWriteOwners);
+
+  /// \brief Sets a directory for caching maps between LFRic and Atlas horizontal ordering. Where
+  ///        set, maps are read from files keyed by grid name, size and a hash of the LFRic
+  ///        coordinates, and newly created maps are written there. An empty string disables this.
+  void setLfricAtlasMapCacheDir(const std::string& cacheDir);
+
+  /// \brief Sets a limit, in bytes, on the memory used by an owner PE to hold the data of a field
+  ///        during serial reads and writes. Where set, each field is read and scattered, or
+  ///        gathered and written, in slabs of vertical levels, the number of which is chosen to fit
+  ///        the limit. At least one level is moved at a time. Zero, the default, disables this.
+  void setMemoryBudget(const std::size_t memoryBudget);
+
+  /// \brief Sets whether serial reads and writes exchange data with owner PEs via a leader PE on
+  ///        each node (see OwnerPlan). Data are shared between the PEs of a node in shared memory,
+  ///        so that an owner PE exchanges one message per node, rather than one per PE. Disabled
+  ///        by default. Must be called by all PEs with the same value.
+  void setNodeAwareExchange(const bool isNodeAware);
+
+  /// \brief Sets the number of threads that remap data between file and Atlas order on an owner
+  ///        PE. Threads are held in a pool for the life of Monio, and only restarted here. Writes
+  ///        divide the levels of the data gathered from each PE between threads, and serial reads
+  ///        divide the PEs whose data are packed. The result does not depend on their number.
+  ///        Non-positive values use the number of hardware threads. One, the default, remaps on the
+  ///        calling thread only.
+  void setRemapThreads(const int numThreads);
+
   /// \brief Can be called elsewhere in MONIO to free disk resources more quickly.
   void closeFiles();
 
+  /// \brief Opens a file on a background thread, ahead of a subsequent read of the same file, e.g.
+  ///        the next ensemble member or time. Must be called by all PEs.
+  void prefetchFile(const std::string& filePath);
+
+  /// \brief Blocks until any asynchronous write (see consts::eAsyncWrite) has completed, and
+  ///        raises any error it encountered, after closing files, on the calling thread. Called by
+  ///        all MONIO file access functions, except reads that can continue alongside the write,
+  ///        so is only required where completion must be known elsewhere, e.g. before the file is
+  ///        used.
+  void flush();
+
   /// \brief A call to open and initialise a state file for reading. This function is public whilst
   ///        it's called from LFRic-Lite.
   int initialiseFile(const atlas::Grid& grid,
@@ -80,6 +170,208 @@ class Monio {
   Monio(const eckit::mpi::Comm& mpiCommunicator,
         const int mpiRankOwner);
 
+  /// \brief Opens a file for any number of reads by a Session. Its file data are initialised, and
+  ///        its variable convention shared, once. One session can be open at a time.
+  void openSession(const atlas::Grid& grid,
+                   const std::string& filePath,
+                   const bool isState);
+
+  /// \brief Reads a field set from the file of the open session.
+  void readSession(atlas::FieldSet& localFieldSet,
+             const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+             const util::DateTime& dateTime,
+             const bool isState);
+
+  /// \brief Closes the file of the open session.
+  void closeSession();
+
+  /// \brief Returns true where the file of the open session is held open (see Session::isOpen).
+  bool isSessionOpen();
+
+  /// \brief Waits, before a read, for an asynchronous write that would conflict with it. That is, a
+  ///        write of the file to be read, or one on a PE that also reads, as NetCDF file access is
+  ///        limited to one thread at a time.
+  void flushForRead(const std::string& filePath);
+
+  /// \brief Initialises a file for reading on the read owner PEs. The path is held on all PEs for
+  ///        later initialisation of the write owner PEs.
+  int initialiseReadFile(const atlas::Grid& grid,
+                         const std::string& filePath,
+                         const bool doCreateDateTimes);
+
+  /// \brief Initialises write owner PEs that are not read owner PEs from the file last initialised
+  ///        for reading, where their file data are not already up to date.
+  void initialiseWriteFile(const atlas::Grid& grid);
+
+  /// \brief Reads and stores the meta/data of a file required for reading and writing on this PE.
+  ///        Called on owner PEs only. Returns the variable convention of the file.
+  int initialiseFileData(const atlas::Grid& grid,
+                         const std::string& filePath,
+                         const bool doCreateDateTimes);
+
+  /// \brief Validates a set of owner PE ranks supplied by a caller.
+  std::vector<std::size_t> getMpiRankOwners(const std::vector<int>& mpiRankOwners) const;
+
+  /// \brief Reads a field set via the owner PEs, which read fields and scatter them directly from
+  ///        file order.
+  void readFieldSetSerial(atlas::FieldSet& localFieldSet,
+                          const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                          const std::string& filePath,
+                          const util::DateTime& dateTime,
+                          const bool isState);
+
+  /// \brief Reads a field set per date-time via the owner PEs, which read each variable across all
+  ///        of the time steps with a single read. Called from readStates.
+  void readFieldSetsSerial(std::vector<atlas::FieldSet>& localFieldSets,
+                     const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                     const std::string& filePath,
+                     const std::vector<util::DateTime>& dateTimes);
+
+  /// \brief Reads fields via the owner PEs one at a time, in slabs of vertical levels that fit the
+  ///        memory budget (see setMemoryBudget). Called from readFieldSetSerial.
+  void readFieldsStreamed(atlas::FieldSet& localFieldSet,
+                    const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                    const std::vector<std::string>& readNames,
+                    const std::vector<std::size_t>& readIndices,
+                          FileData& slabFileData,
+                    const std::vector<std::unique_ptr<OwnerPlan>>& ownerPlans,
+                    const std::size_t timeStep,
+                    const bool isLfricConvention);
+
+  /// \brief Reads a field set via an I/O server PE, which reads fields and scatters them to the
+  ///        compute PEs directly from file order.
+  void readFieldSetFromServer(atlas::FieldSet& localFieldSet,
+                        const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                        const std::string& filePath,
+                        const util::DateTime& dateTime,
+                        const bool isState);
+
+  /// \brief Reads a field set collectively. File geometry is derived by the owner PE and shared.
+  ///        Each PE then reads a contiguous block of each variable, which is redistributed to the
+  ///        PEs that own its points. Requires a NetCDF-4 file and NetCDF built with parallel HDF5.
+  void readFieldSetParallel(atlas::FieldSet& localFieldSet,
+                            const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                            const std::string& filePath,
+                            const util::DateTime& dateTime,
+                            const bool isState);
+
+  /// \brief Writes a field set via the owner PEs, which gather fields directly into LFRic order
+  ///        before writing them in turn.
+  void writeFieldSetSerial(const atlas::FieldSet& localFieldSet,
+                           const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                           const std::string& filePath,
+                           const bool isLfricConvention,
+                           const bool isState);
+
+  /// \brief Writes a field set via a single owner PE, with each batch of fields written while the
+  ///        next is gathered into LFRic order. Called from writeFieldSetSerial with the file open
+  ///        and its FileData prepared.
+  void writeFieldSetPipelined(FileData& fileData,
+                        const atlas::FieldSet& localFieldSet,
+                        const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                        const bool isLfricConvention,
+                        const bool isState);
+
+  /// \brief Writes a field set via the primary owner PE one field at a time, in slabs of vertical
+  ///        levels that fit the memory budget (see setMemoryBudget). Called from
+  ///        writeFieldSetSerial with the file open and its FileData prepared.
+  void writeFieldSetStreamed(FileData& fileData,
+                       const atlas::FieldSet& localFieldSet,
+                       const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                       const bool isLfricConvention,
+                       const bool isState);
+
+  /// \brief Writes a field set asynchronously. Fields are gathered in batches to the primary owner
+  ///        PE, directly into LFRic order, and writing is handed to a background thread.
+  void writeFieldSetAsync(const atlas::FieldSet& localFieldSet,
+                          const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                          const std::string& filePath,
+                          const bool isLfricConvention,
+                          const bool isState);
+
+  /// \brief Writes a field set via an I/O server PE. Fields are gathered to the I/O server PE
+  ///        directly into LFRic order, and compute PEs return before the file is written.
+  void writeFieldSetToServer(const atlas::FieldSet& localFieldSet,
+                             const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                             const std::string& filePath,
+                             const bool isLfricConvention,
+                             const bool isState);
+
+  /// \brief Handles the requests of compute PEs on an I/O server PE, until they are stopped.
+  void serveRequests(const IoServer& ioServer);
+
+  /// \brief Initialises a file on an I/O server PE, and returns its variable convention to the
+  ///        compute PEs.
+  void serveInitialiseRequest(const eckit::mpi::Comm& serverComm,
+                              const int mpiRankServer,
+                              const IoRequest& request);
+
+  /// \brief Reads fields on an I/O server PE, and scatters them to the compute PEs.
+  void serveReadRequest(const eckit::mpi::Comm& serverComm,
+                        const int mpiRankServer,
+                        const IoRequest& request);
+
+  /// \brief Gathers fields from the compute PEs on an I/O server PE, and writes them.
+  void serveWriteRequest(const eckit::mpi::Comm& serverComm,
+                         const int mpiRankServer,
+                         const IoRequest& request);
+
+  /// \brief Writes a field set collectively. The file, its metadata and mesh data are created by
+  ///        the owner PE. All PEs then reopen the file and write a contiguous block of each
+  ///        variable, having received its points from the PEs that own them. Requires a NetCDF
+  ///        library built with parallel HDF5.
+  void writeFieldSetParallel(const atlas::FieldSet& localFieldSet,
+                             const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                             const std::string& filePath,
+                             const bool isLfricConvention,
+                             const bool isState);
+
+  /// \brief Reads a variable on a background thread, into a FileData holding a copy of the file's
+  ///        metadata. Returns the data container. The returned future is invalid where the data
+  ///        are already held in the file's FileData.
+  std::future<std::shared_ptr<DataContainerBase>> readDatumAsync(FileData& prefetchFileData,
+                                                           const FileData& fileData,
+                                                           const std::string& readName,
+                                                           const std::size_t timeStep,
+                                                           const bool isState);
+
+  /// \brief Returns true where this PE is one of the read or write owner PEs, i.e. holds file data.
+  bool isMpiRankOwner() const;
+
+  /// \brief Returns true where this PE is one of the read owner PEs.
+  bool isMpiRankReadOwner() const;
+
+  /// \brief Returns true where this PE is one of the write owner PEs.
+  bool isMpiRankWriteOwner() const;
+
+  /// \brief Configures the read name of each field, and the positions of fields with variables
+  ///        in the file.
+  void getReadNames(const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                    const int variableConvention,
+                    const bool isState,
+                          std::vector<std::string>& readNames,
+                          std::vector<std::size_t>& readIndices) const;
+
+  /// \brief Configures the write name and vertical configuration name of each field.
+  void getWriteNames(const atlas::FieldSet& localFieldSet,
+                     const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                     const bool isLfricConvention,
+                     const bool isState,
+                           std::vector<std::string>& writeNames,
+                           std::vector<std::string>& verticalConfigNames) const;
+
+  /// \brief Creates a plan for each of the given owner PEs, for the exchange of data in file order
+  ///        with the PEs that own the points of a decomposed function space. A collective call.
+  std::vector<std::unique_ptr<OwnerPlan>> createOwnerPlans(
+                                                    const atlas::FunctionSpace& functionSpace,
+                                                    const std::string& gridName,
+                                                    const std::vector<std::size_t>& mpiRankOwners);
+
+  /// \brief Returns the number of vertical levels moved at a time for a field, to fit the memory
+  ///        budget.
+  std::size_t getSlabLevels(const std::size_t globalSize,
+                            const std::size_t numLevels) const;
+
   /// \brief Creates and returns an instance of FileData from an increment file for a given grid
   ///        resolution.
   FileData& createFileData(const std::string& gridName,
@@ -88,8 +380,11 @@ class Monio {
   /// \brief Returns a copy of the data read and produced during file initialisation.
   FileData getFileData(const std::string& gridName);
 
-  /// \brief Creates and stores a map between Atlas and LFRic horizontal ordering.
-  void createLfricAtlasMap(FileData& fileData, const atlas::CubedSphereGrid& grid);
+  /// \brief Creates and stores a map between Atlas and LFRic horizontal ordering. The map of a
+  ///        previous file is reused where both files have identical LFRic coordinates.
+  void createLfricAtlasMap(FileData& fileData,
+                     const atlas::CubedSphereGrid& grid,
+                           FileData& previousFileData);
 
   /// \brief Creates and stores date-times from a state file.
   void createDateTimes(FileData& fileData,
@@ -109,14 +404,29 @@ class Monio {
 
   /// \brief A reference to the MPI communicator passed in at construction.
   const eckit::mpi::Comm& mpiCommunicator_;
-  /// \brief A constant to define the single PE rank used to handle the bulk of MONIO I/O.
-  const std::size_t mpiRankOwner_;
+  /// \brief The primary read owner PE rank, used where MONIO reading is handled by a single PE.
+  std::size_t mpiRankReadOwner_;
+  /// \brief All read owner PE ranks, starting with the primary read owner. Fields are assigned to
+  ///        each in turn.
+  std::vector<std::size_t> mpiRankReadOwners_;
+  /// \brief The primary write owner PE rank, used where MONIO writing is handled by a single PE.
+  std::size_t mpiRankWriteOwner_;
+  /// \brief All write owner PE ranks, starting with the primary write owner. Fields are assigned
+  ///        to each in turn.
+  std::vector<std::size_t> mpiRankWriteOwners_;
 
   /// \brief A member instance of Reader.
   Reader reader_;
   /// \brief A member instance of Writer.
   Writer writer_;
+  /// \brief A member instance of ParallelReader, used by all PEs for collective reads.
+  ParallelReader parallelReader_;
+  /// \brief A member instance of ParallelWriter, used by all PEs for collective writes.
+  ParallelWriter parallelWriter_;
 
+  /// \brief Threads that remap data on owner PEs, shared by atlasReader_ and atlasWriter_. Declared
+  ///        before them, so that it is created first and destroyed last.
+  ThreadPool threadPool_;
   /// \brief A member instance of AtlasReader.
   AtlasReader atlasReader_;
   /// \brief A member instance of AtlasWriter.
@@ -125,5 +435,35 @@ class Monio {
   /// \brief Store of read file meta/data used for writing. Keyed by grid name for storage of data
   ///        at different resolutions.
   std::map<std::string, monio::FileData> filesData_;
+  /// \brief Identities of the files used to initialise each entry of filesData_, for detecting
+  ///        repeated initialisation from an unchanged file. Keyed by grid name.
+  std::map<std::string, std::string> filesDataIds_;
+  /// \brief Directory of cached LFRic-Atlas maps. Empty where caching is disabled.
+  std::string lfricAtlasMapCacheDir_;
+  /// \brief Limit in bytes on the memory used by an owner PE to hold the data of a field. Zero
+  ///        where unlimited.
+  std::size_t memoryBudget_ = 0;
+  /// \brief Whether exchanges with owner PEs are made via node leader PEs.
+  bool isNodeAware_ = false;
+  /// \brief Communicators shared with the I/O server PEs. Held on compute PEs, where I/O servers
+  ///        are started, only.
+  std::unique_ptr<IoServer> ioServer_;
+  /// \brief Paths of the files last used to initialise each grid, held on all PEs. Used to
+  ///        initialise the PEs that write a file where these are not those that read it, i.e. the
+  ///        I/O server PE or the write owner PEs. Keyed by grid name.
+  std::map<std::string, std::string> initFilePaths_;
+  /// \brief Path of the file of the open session, held on all PEs. Empty where there is none.
+  std::string sessionFilePath_;
+  /// \brief Identity of the file of the open session, for detecting where its file data have
+  ///        been replaced by those of another file. Held on read owner PEs only.
+  std::string sessionFileId_;
+  /// \brief Variable convention of the file of the open session, held on all PEs.
+  int sessionVariableConvention_ = consts::eLfricConvention;
+  /// \brief Completion of the current asynchronous write, if any. Valid on the primary write owner
+  ///        PE only, until flushed.
+  std::future<void> pendingWrite_;
+  /// \brief Path of the file of the current asynchronous write, held on all PEs. Empty where there
+  ///        is none.
+  std::string pendingWritePath_;
 };
 }  // namespace monio
@@ -0,0 +1,450 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "OwnerPlan.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <utility>
+
+#include "oops/util/Logger.h"
+
+#include "Monio.h"
+#include "Remap.h"
+#include "Utils.h"
+
+namespace {
+const int kGatherTag = 0;
+const int kScatterTag = 1;
+}  // anonymous namespace
+
+monio::OwnerPlan::OwnerPlan(const eckit::mpi::Comm& mpiCommunicator,
+                            const std::vector<size_t>& localPoints,
+                            const std::vector<size_t>& localGlobalIndices,
+                            const std::vector<size_t>& lfricAtlasMap,
+                            const int mpiRankOwner,
+                            const bool isNodeAware) :
+    mpiCommunicator_(mpiCommunicator),
+    mpiRankOwner_(mpiRankOwner),
+    localPoints_(localPoints),
+    globalSize_(lfricAtlasMap.size()),
+    isNodeAware_(isNodeAware) {
+  oops::Log::debug() << "OwnerPlan::OwnerPlan()" << std::endl;
+  if (localPoints_.size() != localGlobalIndices.size()) {
+    utils::throwException("OwnerPlan::OwnerPlan()> "
+                          "Numbers of local points and global indices do not match...");
+  }
+  mpiCommunicator_.broadcast(globalSize_, mpiRankOwner_);
+  // The owner PE converts the global indices of all PEs' points to file indices
+  const bool isOwner = mpiCommunicator_.rank() == std::size_t(mpiRankOwner_);
+  mpiCommunicator_.gather(static_cast<int>(localPoints_.size()), pointCounts_, mpiRankOwner_);
+  if (isOwner == true) {
+    pointDispls_.assign(pointCounts_.size() + 1, 0);
+    for (std::size_t pe = 0; pe < pointCounts_.size(); ++pe) {
+      pointDispls_[pe + 1] = pointDispls_[pe] + pointCounts_[pe];
+    }
+    fileIndices_.resize(pointDispls_.back());
+  }
+  mpiCommunicator_.gatherv(localGlobalIndices.data(), localGlobalIndices.size(),
+                           fileIndices_.data(), pointCounts_.data(), pointDispls_.data(),
+                           mpiRankOwner_);
+  if (isOwner == true) {
+    for (auto& fileIndex : fileIndices_) {
+      if (fileIndex >= lfricAtlasMap.size()) {
+        Monio::get().closeFiles();
+        utils::throwException("OwnerPlan::OwnerPlan()> "
+                              "Global index exceeds size of LFRic-Atlas map...");
+      }
+      fileIndex = lfricAtlasMap[fileIndex];
+    }
+  }
+  if (isNodeAware_ == true) {
+    createNodeGroups();
+  }
+}
+
+monio::OwnerPlan::~OwnerPlan() {
+  if (nodeComm_ != MPI_COMM_NULL) {
+    MPI_Comm_free(&nodeComm_);
+  }
+}
+
+size_t monio::OwnerPlan::getGlobalSize() const {
+  return globalSize_;
+}
+
+size_t monio::OwnerPlan::getLocalSize() const {
+  return localPoints_.size();
+}
+
+int monio::OwnerPlan::getMpiRankOwner() const {
+  return mpiRankOwner_;
+}
+
+size_t monio::OwnerPlan::getNumPes() const {
+  return mpiCommunicator_.size();
+}
+
+bool monio::OwnerPlan::isMpiRankOwner() const {
+  return mpiCommunicator_.rank() == std::size_t(mpiRankOwner_);
+}
+
+const std::vector<size_t>& monio::OwnerPlan::getLocalPoints() const {
+  return localPoints_;
+}
+
+size_t monio::OwnerPlan::getPointCount(const size_t pe) const {
+  return pointCounts_[pe];
+}
+
+template<typename T>
+void monio::OwnerPlan::packFileData(const std::vector<T>& fileData,
+                                    const size_t levelStart,
+                                    const size_t numLevels,
+                                    const size_t valueOffset,
+                                    const size_t valuesPerPoint,
+                                          std::vector<T>& sendBuffer,
+                                          ThreadPool* threadPool) const {
+  if (fileData.size() < (levelStart + numLevels) * globalSize_) {
+    Monio::get().closeFiles();
+    utils::throwException("OwnerPlan::packFileData()> "
+                          "Read data are not configured for the expected levels...");
+  }
+  if (sendBuffer.size() != fileIndices_.size() * valuesPerPoint ||
+      valueOffset + numLevels > valuesPerPoint) {
+    Monio::get().closeFiles();
+    utils::throwException("OwnerPlan::packFileData()> "
+                          "Send buffer is not configured for the expected levels...");
+  }
+  const T* levelsData = fileData.data() + (levelStart * globalSize_);
+  remap::forBlocks(pointCounts_.size(), 1, threadPool,
+                   [&](const std::size_t peStart, const std::size_t peEnd) {
+    for (std::size_t pe = peStart; pe < peEnd; ++pe) {
+      T* peData = sendBuffer.data() + (pointDispls_[pe] * valuesPerPoint) +
+                                      (pointCounts_[pe] * valueOffset);
+      remap::fileToField<T, T>(levelsData, globalSize_, fileIndices_.data() + pointDispls_[pe],
+                               pointCounts_[pe], numLevels, peData, numLevels);
+    }
+  });
+}
+
+template void monio::OwnerPlan::packFileData<double>(const std::vector<double>& fileData,
+                                                     const size_t levelStart,
+                                                     const size_t numLevels,
+                                                     const size_t valueOffset,
+                                                     const size_t valuesPerPoint,
+                                                           std::vector<double>& sendBuffer,
+                                                           ThreadPool* threadPool) const;
+template void monio::OwnerPlan::packFileData<float>(const std::vector<float>& fileData,
+                                                    const size_t levelStart,
+                                                    const size_t numLevels,
+                                                    const size_t valueOffset,
+                                                    const size_t valuesPerPoint,
+                                                          std::vector<float>& sendBuffer,
+                                                          ThreadPool* threadPool) const;
+template void monio::OwnerPlan::packFileData<int>(const std::vector<int>& fileData,
+                                                  const size_t levelStart,
+                                                  const size_t numLevels,
+                                                  const size_t valueOffset,
+                                                  const size_t valuesPerPoint,
+                                                        std::vector<int>& sendBuffer,
+                                                        ThreadPool* threadPool) const;
+
+void monio::OwnerPlan::broadcast(std::vector<int>& values) const {
+  utils::broadcastVector(mpiCommunicator_, values, mpiRankOwner_);
+}
+
+template<typename T>
+void monio::OwnerPlan::scatter(const std::vector<T>& sendBuffer,
+                               const size_t valuesPerPoint,
+                                     std::vector<T>& localData) const {
+  oops::Log::debug() << "OwnerPlan::scatter()" << std::endl;
+  std::vector<int> sendCounts(pointCounts_.size());
+  std::vector<int> sendDispls(pointCounts_.size());
+  for (std::size_t pe = 0; pe < pointCounts_.size(); ++pe) {
+    sendCounts[pe] = pointCounts_[pe] * valuesPerPoint;
+    sendDispls[pe] = pointDispls_[pe] * valuesPerPoint;
+  }
+  if (mpiCommunicator_.rank() == std::size_t(mpiRankOwner_) &&
+      sendBuffer.size() != fileIndices_.size() * valuesPerPoint) {
+    Monio::get().closeFiles();
+    utils::throwException("OwnerPlan::scatter()> "
+                          "Send buffer is not configured for the expected levels...");
+  }
+  if (isNodeAware_ == true) {
+    scatterByNode<T>(sendBuffer, valuesPerPoint, localData);
+    return;
+  }
+  localData.resize(localPoints_.size() * valuesPerPoint);
+  mpiCommunicator_.scatterv(sendBuffer.data(), sendCounts.data(), sendDispls.data(),
+                            localData.data(), localData.size(), mpiRankOwner_);
+}
+
+template void monio::OwnerPlan::scatter<double>(const std::vector<double>& sendBuffer,
+                                                const size_t valuesPerPoint,
+                                                      std::vector<double>& localData) const;
+template void monio::OwnerPlan::scatter<float>(const std::vector<float>& sendBuffer,
+                                               const size_t valuesPerPoint,
+                                                     std::vector<float>& localData) const;
+template void monio::OwnerPlan::scatter<int>(const std::vector<int>& sendBuffer,
+                                             const size_t valuesPerPoint,
+                                                   std::vector<int>& localData) const;
+
+template<typename T>
+void monio::OwnerPlan::gather(const std::vector<T>& localData,
+                              const size_t valuesPerPoint,
+              const std::function<void(const size_t pe, const T* peData)>& unpackData) const {
+  oops::Log::debug() << "OwnerPlan::gather()" << std::endl;
+  if (localData.size() != localPoints_.size() * valuesPerPoint) {
+    Monio::get().closeFiles();
+    utils::throwException("OwnerPlan::gather()> "
+                          "Local data are not configured for the expected levels...");
+  }
+  if (localData.size() > std::size_t(std::numeric_limits<int>::max())) {
+    Monio::get().closeFiles();
+    utils::throwException("OwnerPlan::gather()> Local data exceed the limit of an MPI count...");
+  }
+  if (isNodeAware_ == true) {
+    gatherByNode<T>(localData, valuesPerPoint, unpackData);
+    return;
+  }
+  if (mpiCommunicator_.rank() != std::size_t(mpiRankOwner_)) {
+    mpiCommunicator_.send(localData.data(), localData.size(), mpiRankOwner_, kGatherTag);
+    return;
+  }
+  // Receives from all other PEs are posted first. The owner PE's own data are unpacked while they
+  // are in progress, then those of other PEs in order of arrival.
+  std::vector<T> recvBuffer(fileIndices_.size() * valuesPerPoint);
+  std::vector<eckit::mpi::Request> requests;
+  std::vector<std::size_t> requestRanks;
+  for (std::size_t pe = 0; pe < pointCounts_.size(); ++pe) {
+    if (pe != std::size_t(mpiRankOwner_)) {
+      requests.push_back(mpiCommunicator_.iReceive(recvBuffer.data() +
+                                                       (pointDispls_[pe] * valuesPerPoint),
+                                                   pointCounts_[pe] * valuesPerPoint,
+                                                   pe, kGatherTag));
+      requestRanks.push_back(pe);
+    }
+  }
+  unpackData(mpiRankOwner_, localData.data());
+  for (std::size_t i = 0; i < requestRanks.size(); ++i) {
+    int requestIndex = 0;
+    mpiCommunicator_.waitAny(requests, requestIndex);
+    std::size_t pe = requestRanks[requestIndex];
+    unpackData(pe, recvBuffer.data() + (pointDispls_[pe] * valuesPerPoint));
+  }
+}
+
+template void monio::OwnerPlan::gather<double>(const std::vector<double>& localData,
+                                               const size_t valuesPerPoint,
+              const std::function<void(const size_t pe, const double* peData)>& unpackData) const;
+template void monio::OwnerPlan::gather<float>(const std::vector<float>& localData,
+                                              const size_t valuesPerPoint,
+              const std::function<void(const size_t pe, const float* peData)>& unpackData) const;
+template void monio::OwnerPlan::gather<int>(const std::vector<int>& localData,
+                                            const size_t valuesPerPoint,
+              const std::function<void(const size_t pe, const int* peData)>& unpackData) const;
+
+template<typename T>
+void monio::OwnerPlan::unpackFileData(const T* peData,
+                                      const size_t numLevels,
+                                      const size_t pe,
+                                            std::vector<T>& fileData,
+                                            ThreadPool* threadPool) const {
+  if (fileData.size() != numLevels * globalSize_) {
+    Monio::get().closeFiles();
+    utils::throwException("OwnerPlan::unpackFileData()> "
+                          "File data are not configured for the expected levels...");
+  }
+  remap::fieldToFile<T, T>(peData, numLevels, fileIndices_.data() + pointDispls_[pe],
+                           pointCounts_[pe], numLevels, fileData.data(), globalSize_, threadPool);
+}
+
+template void monio::OwnerPlan::unpackFileData<double>(const double* peData,
+                                                       const size_t numLevels,
+                                                       const size_t pe,
+                                                             std::vector<double>& fileData,
+                                                             ThreadPool* threadPool) const;
+template void monio::OwnerPlan::unpackFileData<float>(const float* peData,
+                                                      const size_t numLevels,
+                                                      const size_t pe,
+                                                            std::vector<float>& fileData,
+                                                            ThreadPool* threadPool) const;
+template void monio::OwnerPlan::unpackFileData<int>(const int* peData,
+                                                    const size_t numLevels,
+                                                    const size_t pe,
+                                                          std::vector<int>& fileData,
+                                                          ThreadPool* threadPool) const;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void monio::OwnerPlan::createNodeGroups() {
+  oops::Log::debug() << "OwnerPlan::createNodeGroups()" << std::endl;
+  // Node ranks follow the ranks of the communicator, so each node's PEs are in ascending order
+  const int rank = mpiCommunicator_.rank();
+  MPI_Comm mpiComm = MPI_Comm_f2c(mpiCommunicator_.communicator());
+  MPI_Comm_split_type(mpiComm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm_);
+  int nodeSize = 0;
+  int nodeRank = 0;
+  MPI_Comm_size(nodeComm_, &nodeSize);
+  MPI_Comm_rank(nodeComm_, &nodeRank);
+  nodeRank_ = nodeRank;
+  std::uint64_t localValues[2] = {std::uint64_t(rank), localPoints_.size()};
+  std::vector<std::uint64_t> nodeValues(2 * nodeSize);
+  MPI_Allgather(localValues, 2, MPI_UINT64_T, nodeValues.data(), 2, MPI_UINT64_T, nodeComm_);
+  for (int i = 0; i < nodeSize; ++i) {
+    nodePes_.push_back(nodeValues[2 * i]);
+    nodePointCounts_.push_back(nodeValues[(2 * i) + 1]);
+  }
+  isOwnerNode_ = std::find(nodePes_.begin(), nodePes_.end(),
+                           std::size_t(mpiRankOwner_)) != nodePes_.end();
+  // The owner PE groups the PEs of other nodes by their node leaders
+  std::vector<int> nodeLeaders;
+  mpiCommunicator_.gather(static_cast<int>(nodePes_.front()), nodeLeaders, mpiRankOwner_);
+  if (isMpiRankOwner() == true) {
+    std::map<int, std::vector<size_t>> otherNodes;
+    for (std::size_t pe = 0; pe < nodeLeaders.size(); ++pe) {
+      if (nodeLeaders[pe] != static_cast<int>(nodePes_.front())) {
+        otherNodes[nodeLeaders[pe]].push_back(pe);
+      }
+    }
+    for (auto& otherNode : otherNodes) {
+      otherNodesPes_.push_back(std::move(otherNode.second));
+    }
+  }
+}
+
+template<typename T>
+void monio::OwnerPlan::scatterByNode(const std::vector<T>& sendBuffer,
+                                     const size_t valuesPerPoint,
+                                           std::vector<T>& localData) const {
+  oops::Log::debug() << "OwnerPlan::scatterByNode()" << std::endl;
+  std::size_t nodePoints = std::accumulate(nodePointCounts_.begin(), nodePointCounts_.end(),
+                                           std::size_t(0));
+  if (nodePoints * valuesPerPoint > std::size_t(std::numeric_limits<int>::max())) {
+    Monio::get().closeFiles();
+    utils::throwException("OwnerPlan::scatterByNode()> "
+                          "Node data exceed the limit of an MPI count...");
+  }
+  MPI_Win nodeWindow;
+  T* nodeData = allocateNodeWindow<T>(valuesPerPoint, nodeWindow);
+  MPI_Win_fence(0, nodeWindow);
+  // The owner PE places the data of its own node in the window, and sends those of each other
+  // node to its leader
+  std::vector<std::vector<T>> nodeBuffers;
+  std::vector<eckit::mpi::Request> requests;
+  if (isMpiRankOwner() == true) {
+    T* peData = nodeData;
+    for (const std::size_t pe : nodePes_) {
+      peData = std::copy(sendBuffer.begin() + (pointDispls_[pe] * valuesPerPoint),
+                         sendBuffer.begin() + (pointDispls_[pe + 1] * valuesPerPoint), peData);
+    }
+    for (const auto& otherNodePes : otherNodesPes_) {
+      std::vector<T> nodeBuffer;
+      for (const std::size_t pe : otherNodePes) {
+        nodeBuffer.insert(nodeBuffer.end(),
+                          sendBuffer.begin() + (pointDispls_[pe] * valuesPerPoint),
+                          sendBuffer.begin() + (pointDispls_[pe + 1] * valuesPerPoint));
+      }
+      nodeBuffers.push_back(std::move(nodeBuffer));
+      requests.push_back(mpiCommunicator_.iSend(nodeBuffers.back().data(),
+                                                nodeBuffers.back().size(),
+                                                otherNodePes.front(), kScatterTag));
+    }
+  } else if (isOwnerNode_ == false && nodeRank_ == 0) {
+    mpiCommunicator_.receive(nodeData, nodePoints * valuesPerPoint, mpiRankOwner_, kScatterTag);
+  }
+  MPI_Win_fence(0, nodeWindow);
+  // Each PE copies its own data from the window
+  std::size_t nodeOffset = std::accumulate(nodePointCounts_.begin(),
+                                           nodePointCounts_.begin() + nodeRank_, std::size_t(0));
+  localData.assign(nodeData + (nodeOffset * valuesPerPoint),
+                   nodeData + ((nodeOffset + localPoints_.size()) * valuesPerPoint));
+  MPI_Win_fence(0, nodeWindow);
+  MPI_Win_free(&nodeWindow);
+  if (requests.size() != 0) {
+    mpiCommunicator_.waitAll(requests);
+  }
+}
+
+template<typename T>
+void monio::OwnerPlan::gatherByNode(const std::vector<T>& localData,
+                                    const size_t valuesPerPoint,
+              const std::function<void(const size_t pe, const T* peData)>& unpackData) const {
+  oops::Log::debug() << "OwnerPlan::gatherByNode()" << std::endl;
+  std::size_t nodePoints = std::accumulate(nodePointCounts_.begin(), nodePointCounts_.end(),
+                                           std::size_t(0));
+  if (nodePoints * valuesPerPoint > std::size_t(std::numeric_limits<int>::max())) {
+    Monio::get().closeFiles();
+    utils::throwException("OwnerPlan::gatherByNode()> "
+                          "Node data exceed the limit of an MPI count...");
+  }
+  MPI_Win nodeWindow;
+  T* nodeData = allocateNodeWindow<T>(valuesPerPoint, nodeWindow);
+  MPI_Win_fence(0, nodeWindow);
+  std::size_t nodeOffset = std::accumulate(nodePointCounts_.begin(),
+                                           nodePointCounts_.begin() + nodeRank_, std::size_t(0));
+  std::copy(localData.begin(), localData.end(), nodeData + (nodeOffset * valuesPerPoint));
+  MPI_Win_fence(0, nodeWindow);
+  if (isMpiRankOwner() == true) {
+    // Receives from the leaders of other nodes are posted first. The data of the owner PE's own
+    // node are unpacked from the window while they are in progress, then those of other nodes in
+    // order of arrival.
+    std::vector<std::size_t> otherNodeDispls(otherNodesPes_.size() + 1, 0);
+    for (std::size_t node = 0; node < otherNodesPes_.size(); ++node) {
+      otherNodeDispls[node + 1] = otherNodeDispls[node];
+      for (const std::size_t pe : otherNodesPes_[node]) {
+        otherNodeDispls[node + 1] += pointCounts_[pe] * valuesPerPoint;
+      }
+    }
+    std::vector<T> recvBuffer(otherNodeDispls.back());
+    std::vector<eckit::mpi::Request> requests;
+    for (std::size_t node = 0; node < otherNodesPes_.size(); ++node) {
+      requests.push_back(mpiCommunicator_.iReceive(recvBuffer.data() + otherNodeDispls[node],
+                                                   otherNodeDispls[node + 1] -
+                                                   otherNodeDispls[node],
+                                                   otherNodesPes_[node].front(), kGatherTag));
+    }
+    const T* peData = nodeData;
+    for (const std::size_t pe : nodePes_) {
+      unpackData(pe, peData);
+      peData += pointCounts_[pe] * valuesPerPoint;
+    }
+    for (std::size_t i = 0; i < otherNodesPes_.size(); ++i) {
+      int requestIndex = 0;
+      mpiCommunicator_.waitAny(requests, requestIndex);
+      peData = recvBuffer.data() + otherNodeDispls[requestIndex];
+      for (const std::size_t pe : otherNodesPes_[requestIndex]) {
+        unpackData(pe, peData);
+        peData += pointCounts_[pe] * valuesPerPoint;
+      }
+    }
+  } else if (isOwnerNode_ == false && nodeRank_ == 0) {
+    mpiCommunicator_.send(nodeData, nodePoints * valuesPerPoint, mpiRankOwner_, kGatherTag);
+  }
+  MPI_Win_fence(0, nodeWindow);  // The window is read by the owner PE or node leader before freed
+  MPI_Win_free(&nodeWindow);
+}
+
+template<typename T>
+T* monio::OwnerPlan::allocateNodeWindow(const size_t valuesPerPoint,
+                                              MPI_Win& nodeWindow) const {
+  T* localData = nullptr;
+  MPI_Win_allocate_shared(localPoints_.size() * valuesPerPoint * sizeof(T), sizeof(T),
+                          MPI_INFO_NULL, nodeComm_, &localData, &nodeWindow);
+  // The data of a node's PEs are contiguous, in node order. A query of MPI_PROC_NULL returns the
+  // start of the first PE with data.
+  MPI_Aint windowSize = 0;
+  int dispUnit = 0;
+  T* nodeData = nullptr;
+  MPI_Win_shared_query(nodeWindow, MPI_PROC_NULL, &windowSize, &dispUnit, &nodeData);
+  return nodeData;
+}
@@ -0,0 +1,159 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <mpi.h>
+
+#include <functional>
+#include <vector>
+
+#include "eckit/mpi/Comm.h"
+
+#include "ThreadPool.h"
+
+namespace monio {
+/// \brief Describes the exchange of data between an owner PE, which holds them in file order, and
+///        the PEs that own their points in a decomposed field. The owner PE holds the file indices
+///        of each PE's points, so data are packed from, or unpacked into, file order directly,
+///        without remapping via a global field. Used for serial reading and writing.
+///
+///        Where node-aware, data are exchanged in two steps: between the PEs of each node via a
+///        shared-memory window, and between a leader PE of each node and the owner PE. The owner
+///        PE then exchanges one message with each other node, rather than one with each PE, and
+///        the data of its own node are accessed in the window directly.
+class OwnerPlan {
+ public:
+  /// \brief Creates a plan from the positions and (zero-based) Atlas global indices of this PE's
+  ///        locally-owned points. The LFRic-Atlas map is only required on the owner PE. A
+  ///        collective call, for which all PEs must agree on isNodeAware.
+  OwnerPlan(const eckit::mpi::Comm& mpiCommunicator,
+            const std::vector<size_t>& localPoints,
+            const std::vector<size_t>& localGlobalIndices,
+            const std::vector<size_t>& lfricAtlasMap,
+            const int mpiRankOwner,
+            const bool isNodeAware = false);
+
+  ~OwnerPlan();
+
+  OwnerPlan()                            = delete;  //!< Deleted default constructor
+  OwnerPlan(OwnerPlan&&)                 = delete;  //!< Deleted move constructor
+  OwnerPlan(const OwnerPlan&)            = delete;  //!< Deleted copy constructor
+  OwnerPlan& operator=(OwnerPlan&&)      = delete;  //!< Deleted move assignment
+  OwnerPlan& operator=(const OwnerPlan&) = delete;  //!< Deleted copy assignment
+
+  size_t getGlobalSize() const;
+  size_t getLocalSize() const;
+  int getMpiRankOwner() const;
+  size_t getNumPes() const;
+
+  /// \brief Returns true where this PE is the plan's owner PE.
+  bool isMpiRankOwner() const;
+
+  /// \brief Returns the positions of the locally-owned points in a field, in the order their data
+  ///        are received.
+  const std::vector<size_t>& getLocalPoints() const;
+
+  /// \brief Packs the data of one field, for the points of all PEs, into a send buffer on the
+  ///        owner PE that holds valuesPerPoint values for each point. Read data are ordered
+  ///        level-by-level, as in the file. The data of each PE are ordered field-by-field, then
+  ///        point-by-point with levels innermost, as in an Atlas field, with those of this field
+  ///        starting at valueOffset values per point. Data keep the file's type, so are exchanged
+  ///        at its precision, and are converted to the field's type where unpacked on each PE. PEs
+  ///        are divided between the threads of a pool, which pack separate data (see
+  ///        remap::forBlocks).
+  template<typename T> void packFileData(const std::vector<T>& fileData,
+                                         const size_t levelStart,
+                                         const size_t numLevels,
+                                         const size_t valueOffset,
+                                         const size_t valuesPerPoint,
+                                               std::vector<T>& sendBuffer,
+                                               ThreadPool* threadPool = nullptr) const;
+
+  /// \brief Broadcasts values held on the owner PE, such as the data types of the read data to be
+  ///        scattered, to all PEs. A collective call.
+  void broadcast(std::vector<int>& values) const;
+
+  /// \brief Sends the packed data of each PE from the owner PE. valuesPerPoint is the total number
+  ///        of levels packed for each point. A collective call, for which all PEs must agree on T.
+  template<typename T> void scatter(const std::vector<T>& sendBuffer,
+                                    const size_t valuesPerPoint,
+                                          std::vector<T>& localData) const;
+
+  /// \brief Sends the locally-owned data of each PE to the owner PE, where each PE's data are
+  ///        passed to unpackData as they arrive, in any order. Local data are ordered as received
+  ///        by scatter. A collective call, for which all PEs must agree on T, which is given
+  ///        explicitly.
+  template<typename T> void gather(const std::vector<T>& localData,
+                                   const size_t valuesPerPoint,
+              const std::function<void(const size_t pe, const T* peData)>& unpackData) const;
+
+  /// \brief Places a PE's gathered data at their positions in file order, on the owner PE. PE data
+  ///        are ordered point-by-point with levels innermost. File data are ordered
+  ///        level-by-level. Data are remapped in tiles by remap::fieldToFile, with levels divided
+  ///        between the threads of a pool.
+  template<typename T> void unpackFileData(const T* peData,
+                                           const size_t numLevels,
+                                           const size_t pe,
+                                                 std::vector<T>& fileData,
+                                                 ThreadPool* threadPool = nullptr) const;
+
+  /// \brief Returns the number of locally-owned points of a PE. Valid on the owner PE only.
+  size_t getPointCount(const size_t pe) const;
+
+ private:
+  /// \brief Groups PEs by node, and describes the nodes to the owner PE. A collective call.
+  void createNodeGroups();
+
+  /// \brief Node-aware implementation of scatter. Each node leader receives the data of its node
+  ///        into a shared window, from which each PE copies its own.
+  template<typename T> void scatterByNode(const std::vector<T>& sendBuffer,
+                                          const size_t valuesPerPoint,
+                                                std::vector<T>& localData) const;
+
+  /// \brief Node-aware implementation of gather. Each PE copies its data into a shared window,
+  ///        which is sent to the owner PE by its node leader.
+  template<typename T> void gatherByNode(const std::vector<T>& localData,
+                                         const size_t valuesPerPoint,
+              const std::function<void(const size_t pe, const T* peData)>& unpackData) const;
+
+  /// \brief Allocates a shared window holding valuesPerPoint values for each point of this PE's
+  ///        node, in node order, and returns the start of the node's data. A collective call on
+  ///        the node.
+  template<typename T> T* allocateNodeWindow(const size_t valuesPerPoint,
+                                                   MPI_Win& nodeWindow) const;
+
+  const eckit::mpi::Comm& mpiCommunicator_;
+  const int mpiRankOwner_;
+  const std::vector<size_t> localPoints_;
+  size_t globalSize_;
+
+  /// \brief Number of locally-owned points of each PE. Held on the owner PE only.
+  std::vector<int> pointCounts_;
+  /// \brief Position of the first point of each PE in fileIndices_. Held on the owner PE only.
+  std::vector<int> pointDispls_;
+  /// \brief File indices of the locally-owned points of all PEs, grouped by PE. Held on the owner
+  ///        PE only.
+  std::vector<size_t> fileIndices_;
+
+  const bool isNodeAware_;
+  /// \brief Communicator of the PEs sharing memory with this PE. Null where not node-aware.
+  MPI_Comm nodeComm_ = MPI_COMM_NULL;
+  /// \brief Ranks of the PEs of this PE's node, in node order. The first is the node leader.
+  std::vector<size_t> nodePes_;
+  /// \brief Number of locally-owned points of each PE of this PE's node, in node order.
+  std::vector<size_t> nodePointCounts_;
+  /// \brief Position of this PE in nodePes_.
+  size_t nodeRank_ = 0;
+  /// \brief True where the owner PE is on this PE's node.
+  bool isOwnerNode_ = false;
+  /// \brief Ranks of the PEs of each other node, in node order, starting with the node leader.
+  ///        Held on the owner PE only.
+  std::vector<std::vector<size_t>> otherNodesPes_;
+};
+}  // namespace monio
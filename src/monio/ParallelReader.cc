@@ -0,0 +1,141 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "ParallelReader.h"
+
+#include <netcdf>
+#include <utility>
+
+#include "Constants.h"
+#include "DataContainerDouble.h"
+#include "DataContainerFloat.h"
+#include "DataContainerInt.h"
+#include "Utils.h"
+#include "Variable.h"
+
+#include "oops/util/Logger.h"
+
+monio::ParallelReader::ParallelReader(const eckit::mpi::Comm& mpiCommunicator):
+    mpiCommunicator_(mpiCommunicator) {
+  oops::Log::debug() << "ParallelReader::ParallelReader()" << std::endl;
+}
+
+void monio::ParallelReader::openFile(const std::string& filePath) {
+  oops::Log::debug() << "ParallelReader::openFile()" << std::endl;
+  if (filePath.size() != 0) {
+    try {
+      file_ = std::make_unique<File>(filePath, netCDF::NcFile::read, mpiCommunicator_);
+    } catch (netCDF::exceptions::NcException& exception) {
+      utils::throwException("ParallelReader::openFile()> "
+                            "An exception occurred while accessing File...");
+    }
+  }
+}
+
+void monio::ParallelReader::closeFile() {
+  oops::Log::debug() << "ParallelReader::closeFile()" << std::endl;
+  if (isOpen() == true) {
+    getFile().close();
+    file_.release();
+  }
+}
+
+bool monio::ParallelReader::isOpen() {
+  return file_ != nullptr;
+}
+
+void monio::ParallelReader::readMetadata(FileData& fileData) {
+  oops::Log::debug() << "ParallelReader::readMetadata()" << std::endl;
+  getFile().readMetadata(fileData.getMetadata());
+}
+
+void monio::ParallelReader::readDatumBlock(FileData& fileData,
+                                           const std::string& varName,
+                                           const size_t timeStep,
+                                           const size_t levelStart,
+                                           const size_t numLevels,
+                                           const size_t blockStart,
+                                           const size_t blockSize) {
+  oops::Log::debug() << "ParallelReader::readDatumBlock()" << std::endl;
+  if (fileData.getData().isContainerPresent(varName) == false) {
+    std::shared_ptr<Variable> variable = fileData.getMetadata().getVariable(varName);
+    int dataType = variable->getType();
+
+    std::vector<size_t> startVec;
+    std::vector<size_t> countVec;
+    size_t blockDataSize = 1;
+    bool isHorizontalDefined = false;
+    std::vector<std::pair<std::string, size_t>> dimensions = variable->getDimensionsMap();
+    for (auto const& dimPair : dimensions) {
+      if (dimPair.first == consts::kTimeDimName) {
+        startVec.push_back(timeStep);
+        countVec.push_back(1);
+      } else if (dimPair.first == consts::kHorizontalName) {
+        startVec.push_back(blockStart);
+        countVec.push_back(blockSize);
+        blockDataSize *= blockSize;
+        isHorizontalDefined = true;
+      } else {
+        if (levelStart + numLevels > dimPair.second) {
+          utils::throwException("ParallelReader::readDatumBlock()> Levels for variable \"" +
+                                varName + "\" exceed size of dimension \"" +
+                                dimPair.first + "\"...");
+        }
+        startVec.push_back(levelStart);
+        countVec.push_back(numLevels);
+        blockDataSize *= numLevels;
+      }
+    }
+    if (isHorizontalDefined == false) {
+      utils::throwException("ParallelReader::readDatumBlock()> Variable \"" + varName +
+                            "\" has no horizontal dimension...");
+    }
+    std::shared_ptr<DataContainerBase> dataContainer = nullptr;
+    switch (dataType) {
+      case consts::eDataTypes::eDouble: {
+        std::shared_ptr<DataContainerDouble> dataContainerDouble =
+                                    std::make_shared<DataContainerDouble>(varName);
+        dataContainerDouble->setSize(blockDataSize);
+        getFile().readFieldDatum(varName, startVec, countVec, dataContainerDouble->getData());
+        dataContainer = std::static_pointer_cast<DataContainerBase>(dataContainerDouble);
+        break;
+      }
+      case consts::eDataTypes::eFloat: {
+        std::shared_ptr<DataContainerFloat> dataContainerFloat =
+                                    std::make_shared<DataContainerFloat>(varName);
+        dataContainerFloat->setSize(blockDataSize);
+        getFile().readFieldDatum(varName, startVec, countVec, dataContainerFloat->getData());
+        dataContainer = std::static_pointer_cast<DataContainerBase>(dataContainerFloat);
+        break;
+      }
+      case consts::eDataTypes::eInt: {
+        std::shared_ptr<DataContainerInt> dataContainerInt =
+                                    std::make_shared<DataContainerInt>(varName);
+        dataContainerInt->setSize(blockDataSize);
+        getFile().readFieldDatum(varName, startVec, countVec, dataContainerInt->getData());
+        dataContainer = std::static_pointer_cast<DataContainerBase>(dataContainerInt);
+        break;
+      }
+      default: {
+        utils::throwException("ParallelReader::readDatumBlock()> Data type not coded for...");
+      }
+    }
+    fileData.getData().addContainer(dataContainer);
+  } else {
+    oops::Log::debug() << "ParallelReader::readDatumBlock()> DataContainer \""
+      << varName << "\" already defined." << std::endl;
+  }
+}
+
+monio::File& monio::ParallelReader::getFile() {
+  oops::Log::debug() << "ParallelReader::getFile()" << std::endl;
+  if (isOpen() == false) {
+    utils::throwException("ParallelReader::getFile()> File has not been initialised...");
+  }
+  return *file_;
+}
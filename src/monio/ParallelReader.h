@@ -0,0 +1,57 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "eckit/mpi/Comm.h"
+
+#include "File.h"
+#include "FileData.h"
+
+namespace monio {
+/// \brief Reads from a NetCDF file opened collectively by all PEs. Each PE reads a contiguous block
+///        of horizontal points, so no single PE holds complete variables. All calls are collective.
+class ParallelReader {
+ public:
+  explicit ParallelReader(const eckit::mpi::Comm& mpiCommunicator);
+
+  ParallelReader()                                 = delete;  //!< Deleted default constructor
+  ParallelReader(ParallelReader&&)                 = delete;  //!< Deleted move constructor
+  ParallelReader(const ParallelReader&)            = delete;  //!< Deleted copy constructor
+  ParallelReader& operator=(ParallelReader&&)      = delete;  //!< Deleted move assignment
+  ParallelReader& operator=(const ParallelReader&) = delete;  //!< Deleted copy assignment
+
+  void openFile(const std::string& filePath);
+  void closeFile();
+  bool isOpen();
+
+  void readMetadata(FileData& fileData);
+
+  /// \brief Reads a block of horizontal points for a single variable at a time step, where the
+  ///        variable has a time dimension. Reads numLevels vertical levels from levelStart. Data
+  ///        are stored level-by-level, as in the file.
+  void readDatumBlock(FileData& fileData,
+                      const std::string& varName,
+                      const size_t timeStep,
+                      const size_t levelStart,
+                      const size_t numLevels,
+                      const size_t blockStart,
+                      const size_t blockSize);
+
+ private:
+  File& getFile();
+
+  const eckit::mpi::Comm& mpiCommunicator_;
+
+  std::unique_ptr<File> file_;
+};
+}  // namespace monio
@@ -0,0 +1,124 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "ParallelWriter.h"
+
+#include <netcdf>
+#include <utility>
+#include <vector>
+
+#include "Constants.h"
+#include "DataContainerDouble.h"
+#include "DataContainerFloat.h"
+#include "DataContainerInt.h"
+#include "Utils.h"
+
+#include "oops/util/Logger.h"
+
+namespace {
+void checkBlockDataSize(const std::string& varName,
+                        const size_t dataSize,
+                        const size_t blockDataSize) {
+  if (dataSize != blockDataSize) {
+    monio::utils::throwException("ParallelWriter::writeDatumBlock()> Data for variable \"" +
+                                 varName + "\" do not match the size of the block...");
+  }
+}
+}  // anonymous namespace
+
+monio::ParallelWriter::ParallelWriter(const eckit::mpi::Comm& mpiCommunicator):
+    mpiCommunicator_(mpiCommunicator) {
+  oops::Log::debug() << "ParallelWriter::ParallelWriter()" << std::endl;
+}
+
+void monio::ParallelWriter::openFile(const std::string& filePath) {
+  oops::Log::debug() << "ParallelWriter::openFile() \"" << filePath << "\"..." << std::endl;
+  if (filePath.size() != 0) {
+    try {
+      file_ = std::make_unique<File>(filePath, netCDF::NcFile::write, mpiCommunicator_);
+    } catch (netCDF::exceptions::NcException& exception) {
+      utils::throwException("ParallelWriter::openFile()> "
+                            "An exception occurred while accessing File...");
+    }
+  }
+}
+
+void monio::ParallelWriter::closeFile() {
+  oops::Log::debug() << "ParallelWriter::closeFile()" << std::endl;
+  if (isOpen() == true) {
+    getFile().close();
+    file_.release();
+  }
+}
+
+bool monio::ParallelWriter::isOpen() {
+  return file_ != nullptr;
+}
+
+void monio::ParallelWriter::writeDatumBlock(
+                                const std::shared_ptr<DataContainerBase>& dataContainer,
+                                const size_t blockStart,
+                                const size_t blockSize) {
+  oops::Log::debug() << "ParallelWriter::writeDatumBlock()" << std::endl;
+  std::string varName = dataContainer->getName();
+  std::vector<size_t> startVec;
+  std::vector<size_t> countVec;
+  size_t blockDataSize = 1;
+  bool isHorizontalDefined = false;
+  std::vector<std::pair<std::string, size_t>> dimensions = getFile().getVarDimensions(varName);
+  for (auto const& dimPair : dimensions) {
+    if (dimPair.first == consts::kHorizontalName) {
+      startVec.push_back(blockStart);
+      countVec.push_back(blockSize);
+      blockDataSize *= blockSize;
+      isHorizontalDefined = true;
+    } else {
+      startVec.push_back(0);
+      countVec.push_back(dimPair.second);
+      blockDataSize *= dimPair.second;
+    }
+  }
+  if (isHorizontalDefined == false) {
+    utils::throwException("ParallelWriter::writeDatumBlock()> Variable \"" + varName +
+                          "\" has no horizontal dimension...");
+  }
+  switch (dataContainer->getType()) {
+    case consts::eDataTypes::eDouble: {
+      std::shared_ptr<DataContainerDouble> dataContainerDouble =
+          std::static_pointer_cast<DataContainerDouble>(dataContainer);
+      checkBlockDataSize(varName, dataContainerDouble->getData().size(), blockDataSize);
+      getFile().writeFieldDatum(varName, startVec, countVec, dataContainerDouble->getData());
+      break;
+    }
+    case consts::eDataTypes::eFloat: {
+      std::shared_ptr<DataContainerFloat> dataContainerFloat =
+          std::static_pointer_cast<DataContainerFloat>(dataContainer);
+      checkBlockDataSize(varName, dataContainerFloat->getData().size(), blockDataSize);
+      getFile().writeFieldDatum(varName, startVec, countVec, dataContainerFloat->getData());
+      break;
+    }
+    case consts::eDataTypes::eInt: {
+      std::shared_ptr<DataContainerInt> dataContainerInt =
+          std::static_pointer_cast<DataContainerInt>(dataContainer);
+      checkBlockDataSize(varName, dataContainerInt->getData().size(), blockDataSize);
+      getFile().writeFieldDatum(varName, startVec, countVec, dataContainerInt->getData());
+      break;
+    }
+    default: {
+      utils::throwException("ParallelWriter::writeDatumBlock()> Data type not coded for...");
+    }
+  }
+}
+
+monio::File& monio::ParallelWriter::getFile() {
+  oops::Log::debug() << "ParallelWriter::getFile()" << std::endl;
+  if (isOpen() == false) {
+    utils::throwException("ParallelWriter::getFile()> File has not been initialised...");
+  }
+  return *file_;
+}
@@ -0,0 +1,50 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "eckit/mpi/Comm.h"
+
+#include "DataContainerBase.h"
+#include "File.h"
+
+namespace monio {
+/// \brief Writes to an existing NetCDF file opened collectively by all PEs. Each PE writes a
+///        contiguous block of horizontal points. Variables must already be defined in the file.
+///        All calls are collective.
+class ParallelWriter {
+ public:
+  explicit ParallelWriter(const eckit::mpi::Comm& mpiCommunicator);
+
+  ParallelWriter()                                 = delete;  //!< Deleted default constructor
+  ParallelWriter(ParallelWriter&&)                 = delete;  //!< Deleted move constructor
+  ParallelWriter(const ParallelWriter&)            = delete;  //!< Deleted copy constructor
+  ParallelWriter& operator=(ParallelWriter&&)      = delete;  //!< Deleted move assignment
+  ParallelWriter& operator=(const ParallelWriter&) = delete;  //!< Deleted copy assignment
+
+  void openFile(const std::string& filePath);
+  void closeFile();
+  bool isOpen();
+
+  /// \brief Writes a block of horizontal points for all levels of a single variable. Data are
+  ///        ordered level-by-level, as in the file.
+  void writeDatumBlock(const std::shared_ptr<DataContainerBase>& dataContainer,
+                       const size_t blockStart,
+                       const size_t blockSize);
+
+ private:
+  File& getFile();
+
+  const eckit::mpi::Comm& mpiCommunicator_;
+
+  std::unique_ptr<File> file_;
+};
+}  // namespace monio
@@ -40,12 +40,22 @@ monio::Reader::Reader(const eckit::mpi::Comm& mpiCommunicator,
   oops::Log::debug() << "Reader::Reader()" << std::endl;
 }
 
+void monio::Reader::setMpiRankOwner(const int mpiRankOwner) {
+  oops::Log::debug() << "Reader::setMpiRankOwner()" << std::endl;
+  mpiRankOwner_ = mpiRankOwner;
+}
+
 void monio::Reader::openFile(const std::string& filePath) {
   oops::Log::debug() << "Reader::openFile()" << std::endl;
   if (mpiCommunicator_.rank() == mpiRankOwner_) {
     if (filePath.size() != 0) {
       try {
-        file_ = std::make_unique<File>(filePath, netCDF::NcFile::read);
+        if (prefetchFile_.valid() == true && prefetchFilePath_ == filePath) {
+          file_ = prefetchFile_.get();
+        } else {
+          prefetchFile_ = std::future<std::unique_ptr<File>>();  // Discards other prefetched file
+          file_ = std::make_unique<File>(filePath, netCDF::NcFile::read);
+        }
       } catch (netCDF::exceptions::NcException& exception) {
         closeFile();
         utils::throwException("Reader::openFile()> An exception occurred while accessing File...");
@@ -54,6 +64,23 @@ void monio::Reader::openFile(const std::string& filePath) {
   }
 }
 
+void monio::Reader::prefetchFile(const std::string& filePath) {
+  oops::Log::debug() << "Reader::prefetchFile()" << std::endl;
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    waitForPrefetch();
+    prefetchFilePath_ = filePath;
+    prefetchFile_ = std::async(std::launch::async, [filePath]() {
+      return std::make_unique<File>(filePath, netCDF::NcFile::read);
+    });
+  }
+}
+
+void monio::Reader::waitForPrefetch() {
+  if (prefetchFile_.valid() == true) {
+    prefetchFile_.wait();
+  }
+}
+
 void monio::Reader::closeFile() {
   oops::Log::debug() << "Reader::closeFile()" << std::endl;
   if (mpiCommunicator_.rank() == mpiRankOwner_) {
@@ -68,6 +95,10 @@ bool monio::Reader::isOpen() {
   return file_ != nullptr;
 }
 
+bool monio::Reader::isOpen(const std::string& filePath) {
+  return file_ != nullptr && file_->getPath() == filePath;
+}
+
 void monio::Reader::readMetadata(FileData& fileData) {
   oops::Log::debug() << "Reader::readMetadata()" << std::endl;
   if (mpiCommunicator_.rank() == mpiRankOwner_) {
@@ -158,6 +189,83 @@ void monio::Reader::readDatumAtTime(FileData& fileData,
   }
 }
 
+void monio::Reader::readDatumLevels(FileData& fileData,
+                                    const std::string& varName,
+                                    const size_t timeStep,
+                                    const size_t levelStart,
+                                    const size_t numLevels) {
+  oops::Log::debug() << "Reader::readDatumLevels()" << std::endl;
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    if (fileData.getData().isContainerPresent(varName) == false) {
+      std::shared_ptr<Variable> variable = fileData.getMetadata().getVariable(varName);
+      std::vector<size_t> startVec;
+      std::vector<size_t> countVec;
+      size_t slabSize = 1;
+      std::vector<std::pair<std::string, size_t>> dimensions = variable->getDimensionsMap();
+      for (auto const& dimPair : dimensions) {
+        if (dimPair.first == consts::kTimeDimName) {
+          startVec.push_back(timeStep);
+          countVec.push_back(1);
+        } else if (dimPair.first == consts::kHorizontalName) {
+          startVec.push_back(0);
+          countVec.push_back(dimPair.second);
+          slabSize *= dimPair.second;
+        } else {
+          if (levelStart + numLevels > dimPair.second) {
+            closeFile();
+            utils::throwException("Reader::readDatumLevels()> Levels for variable \"" +
+                                  varName + "\" exceed size of dimension \"" +
+                                  dimPair.first + "\"...");
+          }
+          startVec.push_back(levelStart);
+          countVec.push_back(numLevels);
+          slabSize *= numLevels;
+        }
+      }
+      readDatumSlab(fileData, varName, startVec, countVec, slabSize);
+    } else {
+      oops::Log::debug() << "Reader::readDatumLevels()> DataContainer \""
+        << varName << "\" already defined." << std::endl;
+    }
+  }
+}
+
+void monio::Reader::readDatumAtTimes(FileData& fileData,
+                                     const std::string& varName,
+                                     const size_t timeStart,
+                                     const size_t numTimes) {
+  oops::Log::debug() << "Reader::readDatumAtTimes()" << std::endl;
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    if (fileData.getData().isContainerPresent(varName) == false) {
+      std::shared_ptr<Variable> variable = fileData.getMetadata().getVariable(varName);
+      std::vector<size_t> startVec;
+      std::vector<size_t> countVec;
+      size_t slabSize = 1;
+      std::vector<std::pair<std::string, size_t>> dimensions = variable->getDimensionsMap();
+      for (std::size_t i = 0; i < dimensions.size(); ++i) {
+        if (dimensions[i].first == consts::kTimeDimName) {
+          if (i != 0 || timeStart + numTimes > dimensions[i].second) {
+            closeFile();
+            utils::throwException("Reader::readDatumAtTimes()> Time steps for variable \"" +
+                                  varName + "\" are not outermost, or exceed the file...");
+          }
+          startVec.push_back(timeStart);
+          countVec.push_back(numTimes);
+          slabSize *= numTimes;
+        } else {
+          startVec.push_back(0);
+          countVec.push_back(dimensions[i].second);
+          slabSize *= dimensions[i].second;
+        }
+      }
+      readDatumSlab(fileData, varName, startVec, countVec, slabSize);
+    } else {
+      oops::Log::debug() << "Reader::readDatumAtTimes()> DataContainer \""
+        << varName << "\" already defined." << std::endl;
+    }
+  }
+}
+
 void monio::Reader::readAllData(FileData& fileData) {
   oops::Log::debug() << "Reader::readAllData()" << std::endl;
   if (mpiCommunicator_.rank() == mpiRankOwner_) {
@@ -224,6 +332,47 @@ void monio::Reader::readFullDatum(FileData& fileData,
   }
 }
 
+void monio::Reader::readDatumSlab(FileData& fileData,
+                                  const std::string& varName,
+                                  const std::vector<size_t>& startVec,
+                                  const std::vector<size_t>& countVec,
+                                  const size_t slabSize) {
+  oops::Log::debug() << "Reader::readDatumSlab()" << std::endl;
+  int dataType = fileData.getMetadata().getVariable(varName)->getType();
+  std::shared_ptr<DataContainerBase> dataContainer = nullptr;
+  switch (dataType) {
+    case consts::eDataTypes::eDouble: {
+      std::shared_ptr<DataContainerDouble> dataContainerDouble =
+                                  std::make_shared<DataContainerDouble>(varName);
+      dataContainerDouble->setSize(slabSize);
+      getFile().readFieldDatum(varName, startVec, countVec, dataContainerDouble->getData());
+      dataContainer = std::static_pointer_cast<DataContainerBase>(dataContainerDouble);
+      break;
+    }
+    case consts::eDataTypes::eFloat: {
+      std::shared_ptr<DataContainerFloat> dataContainerFloat =
+                                  std::make_shared<DataContainerFloat>(varName);
+      dataContainerFloat->setSize(slabSize);
+      getFile().readFieldDatum(varName, startVec, countVec, dataContainerFloat->getData());
+      dataContainer = std::static_pointer_cast<DataContainerBase>(dataContainerFloat);
+      break;
+    }
+    case consts::eDataTypes::eInt: {
+      std::shared_ptr<DataContainerInt> dataContainerInt =
+                                  std::make_shared<DataContainerInt>(varName);
+      dataContainerInt->setSize(slabSize);
+      getFile().readFieldDatum(varName, startVec, countVec, dataContainerInt->getData());
+      dataContainer = std::static_pointer_cast<DataContainerBase>(dataContainerInt);
+      break;
+    }
+    default: {
+      closeFile();
+      utils::throwException("Reader::readDatumSlab()> Data type not coded for...");
+    }
+  }
+  fileData.getData().addContainer(dataContainer);
+}
+
 monio::File& monio::Reader::getFile() {
   oops::Log::debug() << "Reader::getFile()" << std::endl;
   if (isOpen() == false) {
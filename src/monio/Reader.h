@@ -8,6 +8,7 @@
 ******************************************************************************/
 #pragma once
 
+#include <future>  // NOLINT(build/c++11)
 #include <map>
 #include <memory>
 #include <string>
@@ -38,9 +39,22 @@ class Reader {
   Reader& operator=(Reader&&)      = delete;  //!< Deleted move assignment
   Reader& operator=(const Reader&) = delete;  //!< Deleted copy assignment
 
+  /// \brief Sets the PE rank that handles I/O. Where there are multiple owner PEs, each owner PE
+  ///        sets its own rank.
+  void setMpiRankOwner(const int mpiRankOwner);
+
+  /// \brief Opens a file. A file opened by prefetchFile with the same path is used where present.
   void openFile(const std::string& filePath);
   void closeFile();
   bool isOpen();
+  /// \brief Returns true where the file with the given path is open.
+  bool isOpen(const std::string& filePath);
+
+  /// \brief Opens a file on a background thread, for use by a subsequent call to openFile.
+  void prefetchFile(const std::string& filePath);
+  /// \brief Blocks until a file opened by prefetchFile is open. NetCDF is not thread-safe, so this
+  ///        must be called before any other file access.
+  void waitForPrefetch();
 
   void readMetadata(FileData& fileData);
   /// \brief Reads complete data for a set of variables defined in metadata.
@@ -63,19 +77,46 @@ class Reader {
                       const size_t timeStep,
                       const std::string& timeDimName);
 
+  /// \brief Reads a slab of vertical levels of a single variable, at a particular time step where
+  ///        the variable has a time dimension.
+  void readDatumLevels(FileData& fileData,
+                       const std::string& variableName,
+                       const size_t timeStep,
+                       const size_t levelStart,
+                       const size_t numLevels);
+
+  /// \brief Reads all levels of a single variable across a contiguous range of time steps, with a
+  ///        single read. Data are ordered by time step, where the variable has a time dimension,
+  ///        which must be its outermost.
+  void readDatumAtTimes(FileData& fileData,
+                        const std::string& variableName,
+                        const size_t timeStart,
+                        const size_t numTimes);
+
   /// \brief Copies of coordinate data from the set of populated data containers.
   std::vector<std::shared_ptr<DataContainerBase>> getCoordData(FileData& fileData,
                                                   const std::vector<std::string>& coordNames);
 
- private:
   /// \brief Converts a date-time into a time step.
   size_t findTimeStep(const FileData& fileData, const util::DateTime& dateTime);
 
+ private:
   File& getFile();
 
+  /// \brief Reads a hyperslab of a single variable into a new data container.
+  void readDatumSlab(FileData& fileData,
+                     const std::string& varName,
+                     const std::vector<size_t>& startVec,
+                     const std::vector<size_t>& countVec,
+                     const size_t slabSize);
+
   const eckit::mpi::Comm& mpiCommunicator_;
-  const std::size_t mpiRankOwner_;
+  std::size_t mpiRankOwner_;
 
   std::unique_ptr<File> file_;
+
+  /// \brief Path and pending result of a file opened by prefetchFile.
+  std::string prefetchFilePath_;
+  std::future<std::unique_ptr<File>> prefetchFile_;
 };
 }  // namespace monio
@@ -0,0 +1,217 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "Remap.h"
+
+#include <algorithm>
+
+bool monio::remap::isPermutation(const std::vector<size_t>& lfricToAtlasMap) {
+  std::vector<bool> isMapped(lfricToAtlasMap.size(), false);
+  for (const size_t index : lfricToAtlasMap) {
+    if (index >= isMapped.size() || isMapped[index] == true) {
+      return false;
+    }
+    isMapped[index] = true;
+  }
+  return true;
+}
+
+void monio::remap::forBlocks(const std::size_t numItems,
+                             const std::size_t tileSize,
+                                   ThreadPool* threadPool,
+                             const std::function<void(const std::size_t blockStart,
+                                                      const std::size_t blockEnd)>& processBlock) {
+  std::size_t numTiles = (numItems + tileSize - 1) / tileSize;
+  std::size_t threadCount = threadPool != nullptr ? threadPool->getNumThreads() : 1;
+  threadCount = std::max(std::size_t(1), std::min(threadCount, numTiles));
+  if (threadCount == 1) {
+    processBlock(0, numItems);
+    return;
+  }
+  std::size_t blockSize = ((numTiles + threadCount - 1) / threadCount) * tileSize;
+  threadPool->run(threadCount, [&](const std::size_t block) {
+    std::size_t start = std::min(block * blockSize, numItems);
+    std::size_t end = std::min(start + blockSize, numItems);
+    processBlock(start, end);
+  });
+}
+
+template<typename FileT, typename FieldT>
+void monio::remap::fileToField(const FileT* fileData,
+                               const std::size_t fileLevelSize,
+                               const size_t* fileIndices,
+                               const std::size_t numPoints,
+                               const std::size_t numLevels,
+                                     FieldT* fieldData,
+                               const std::size_t fieldStride,
+                                     ThreadPool* threadPool) {
+  static_assert(isConvertible<FileT, FieldT>(), "Conversion of data types is not supported.");
+  forBlocks(numLevels, levelTile<FieldT>(), threadPool,
+            [&](const std::size_t blockStart, const std::size_t blockEnd) {
+    for (std::size_t pointStart = 0; pointStart < numPoints; pointStart += kPointTile) {
+      const std::size_t pointEnd = std::min(pointStart + kPointTile, numPoints);
+      for (std::size_t levelStart = blockStart; levelStart < blockEnd;
+           levelStart += levelTile<FieldT>()) {
+        const std::size_t levelEnd = std::min(levelStart + levelTile<FieldT>(), blockEnd);
+        // Writes to each point are contiguous. Reads of each point are a constant-stride gather,
+        // converted as they are written.
+        for (std::size_t i = pointStart; i < pointEnd; ++i) {
+          const FileT* pointData = fileData + fileIndices[i];
+          FieldT* fieldPointData = fieldData + (i * fieldStride);
+          for (std::size_t j = levelStart; j < levelEnd; ++j) {
+            fieldPointData[j] = static_cast<FieldT>(pointData[j * fileLevelSize]);
+          }
+        }
+      }
+    }
+  });
+}
+
+template void monio::remap::fileToField<double, double>(const double* fileData,
+                                                        const std::size_t fileLevelSize,
+                                                        const size_t* fileIndices,
+                                                        const std::size_t numPoints,
+                                                        const std::size_t numLevels,
+                                                              double* fieldData,
+                                                        const std::size_t fieldStride,
+                                                              ThreadPool* threadPool);
+template void monio::remap::fileToField<float, float>(const float* fileData,
+                                                      const std::size_t fileLevelSize,
+                                                      const size_t* fileIndices,
+                                                      const std::size_t numPoints,
+                                                      const std::size_t numLevels,
+                                                            float* fieldData,
+                                                      const std::size_t fieldStride,
+                                                            ThreadPool* threadPool);
+template void monio::remap::fileToField<int, int>(const int* fileData,
+                                                  const std::size_t fileLevelSize,
+                                                  const size_t* fileIndices,
+                                                  const std::size_t numPoints,
+                                                  const std::size_t numLevels,
+                                                        int* fieldData,
+                                                  const std::size_t fieldStride,
+                                                        ThreadPool* threadPool);
+template void monio::remap::fileToField<float, double>(const float* fileData,
+                                                       const std::size_t fileLevelSize,
+                                                       const size_t* fileIndices,
+                                                       const std::size_t numPoints,
+                                                       const std::size_t numLevels,
+                                                             double* fieldData,
+                                                       const std::size_t fieldStride,
+                                                             ThreadPool* threadPool);
+template void monio::remap::fileToField<int, double>(const int* fileData,
+                                                     const std::size_t fileLevelSize,
+                                                     const size_t* fileIndices,
+                                                     const std::size_t numPoints,
+                                                     const std::size_t numLevels,
+                                                           double* fieldData,
+                                                     const std::size_t fieldStride,
+                                                           ThreadPool* threadPool);
+template void monio::remap::fileToField<double, float>(const double* fileData,
+                                                       const std::size_t fileLevelSize,
+                                                       const size_t* fileIndices,
+                                                       const std::size_t numPoints,
+                                                       const std::size_t numLevels,
+                                                             float* fieldData,
+                                                       const std::size_t fieldStride,
+                                                             ThreadPool* threadPool);
+template void monio::remap::fileToField<int, float>(const int* fileData,
+                                                    const std::size_t fileLevelSize,
+                                                    const size_t* fileIndices,
+                                                    const std::size_t numPoints,
+                                                    const std::size_t numLevels,
+                                                          float* fieldData,
+                                                    const std::size_t fieldStride,
+                                                          ThreadPool* threadPool);
+
+template<typename FieldT, typename FileT>
+void monio::remap::fieldToFile(const FieldT* fieldData,
+                               const std::size_t fieldStride,
+                               const size_t* fileIndices,
+                               const std::size_t numPoints,
+                               const std::size_t numLevels,
+                                     FileT* fileData,
+                               const std::size_t fileLevelSize,
+                                     ThreadPool* threadPool) {
+  static_assert(isConvertible<FieldT, FileT>(), "Conversion of data types is not supported.");
+  forBlocks(numLevels, levelTile<FieldT>(), threadPool,
+            [&](const std::size_t blockStart, const std::size_t blockEnd) {
+    for (std::size_t pointStart = 0; pointStart < numPoints; pointStart += kPointTile) {
+      const std::size_t pointEnd = std::min(pointStart + kPointTile, numPoints);
+      for (std::size_t levelStart = blockStart; levelStart < blockEnd;
+           levelStart += levelTile<FieldT>()) {
+        const std::size_t levelEnd = std::min(levelStart + levelTile<FieldT>(), blockEnd);
+        // Reads of each point are contiguous, and converted before a constant-stride scatter.
+        for (std::size_t i = pointStart; i < pointEnd; ++i) {
+          const FieldT* fieldPointData = fieldData + (i * fieldStride);
+          FileT* pointData = fileData + fileIndices[i];
+          for (std::size_t j = levelStart; j < levelEnd; ++j) {
+            pointData[j * fileLevelSize] = static_cast<FileT>(fieldPointData[j]);
+          }
+        }
+      }
+    }
+  });
+}
+
+template void monio::remap::fieldToFile<double, double>(const double* fieldData,
+                                                        const std::size_t fieldStride,
+                                                        const size_t* fileIndices,
+                                                        const std::size_t numPoints,
+                                                        const std::size_t numLevels,
+                                                              double* fileData,
+                                                        const std::size_t fileLevelSize,
+                                                              ThreadPool* threadPool);
+template void monio::remap::fieldToFile<float, float>(const float* fieldData,
+                                                      const std::size_t fieldStride,
+                                                      const size_t* fileIndices,
+                                                      const std::size_t numPoints,
+                                                      const std::size_t numLevels,
+                                                            float* fileData,
+                                                      const std::size_t fileLevelSize,
+                                                            ThreadPool* threadPool);
+template void monio::remap::fieldToFile<int, int>(const int* fieldData,
+                                                  const std::size_t fieldStride,
+                                                  const size_t* fileIndices,
+                                                  const std::size_t numPoints,
+                                                  const std::size_t numLevels,
+                                                        int* fileData,
+                                                  const std::size_t fileLevelSize,
+                                                        ThreadPool* threadPool);
+template void monio::remap::fieldToFile<float, double>(const float* fieldData,
+                                                       const std::size_t fieldStride,
+                                                       const size_t* fileIndices,
+                                                       const std::size_t numPoints,
+                                                       const std::size_t numLevels,
+                                                             double* fileData,
+                                                       const std::size_t fileLevelSize,
+                                                             ThreadPool* threadPool);
+template void monio::remap::fieldToFile<int, double>(const int* fieldData,
+                                                     const std::size_t fieldStride,
+                                                     const size_t* fileIndices,
+                                                     const std::size_t numPoints,
+                                                     const std::size_t numLevels,
+                                                           double* fileData,
+                                                     const std::size_t fileLevelSize,
+                                                           ThreadPool* threadPool);
+template void monio::remap::fieldToFile<double, float>(const double* fieldData,
+                                                       const std::size_t fieldStride,
+                                                       const size_t* fileIndices,
+                                                       const std::size_t numPoints,
+                                                       const std::size_t numLevels,
+                                                             float* fileData,
+                                                       const std::size_t fileLevelSize,
+                                                             ThreadPool* threadPool);
+template void monio::remap::fieldToFile<int, float>(const int* fieldData,
+                                                    const std::size_t fieldStride,
+                                                    const size_t* fileIndices,
+                                                    const std::size_t numPoints,
+                                                    const std::size_t numLevels,
+                                                          float* fileData,
+                                                    const std::size_t fileLevelSize,
+                                                          ThreadPool* threadPool);
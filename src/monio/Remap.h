@@ -0,0 +1,87 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "ThreadPool.h"
+
+namespace monio {
+/// \brief Contains kernels that permute and transpose field data between file order, where each
+///        level holds all points in LFRic order, and Atlas order, where the levels of each point
+///        are contiguous. Points and levels are processed in tiles small enough to stay in cache,
+///        so that neither side is traversed with a stride of the number of points for long. Kernels
+///        can divide their levels between the threads of a pool, which write separate data, so
+///        that the result does not depend on the number of threads. Where the file and field data
+///        types differ, values are converted as they are copied, so no converted copy of either is
+///        made.
+namespace remap {
+  const std::size_t kCacheLineSize = 64;
+  const std::size_t kPointTile = 256;
+
+  /// \brief Number of levels in a tile, for a given data type. A cache line of each point's levels.
+  template<typename T> constexpr std::size_t levelTile() {
+    return kCacheLineSize / sizeof(T);
+  }
+
+  /// \brief Returns whether kernels convert data of type FromT to type ToT. Floating-point data
+  ///        are converted from any type, but integer data only from integer data.
+  template<typename FromT, typename ToT> constexpr bool isConvertible() {
+    return std::is_same<FromT, ToT>::value || std::is_floating_point<ToT>::value;
+  }
+
+  /// \brief Returns whether a map holds each index from zero to its size exactly once. Maps are
+  ///        validated once, where they are created, so that kernels need not check indices.
+  bool isPermutation(const std::vector<size_t>& lfricToAtlasMap);
+
+  /// \brief Divides a range of items, e.g. levels or PEs, into contiguous blocks of whole tiles,
+  ///        one for each thread of a pool, and submits processBlock for each block to the pool.
+  ///        The first block is processed on the calling thread. Without a pool, the range is
+  ///        processed as one block on the calling thread.
+  void forBlocks(const std::size_t numItems,
+                 const std::size_t tileSize,
+                       ThreadPool* threadPool,
+                 const std::function<void(const std::size_t blockStart,
+                                          const std::size_t blockEnd)>& processBlock);
+
+  /// \brief Copies numLevels levels of file data to field data with the given stride between
+  ///        points, converting from FileT to FieldT. Each level of file data holds fileLevelSize
+  ///        points. Field data for point i are read from file point fileIndices[i], so that any
+  ///        subset of points, e.g. those of one PE, can be copied. Callers copying from a later
+  ///        level offset fileData by whole levels. Indices are not checked, so must be less than
+  ///        fileLevelSize.
+  template<typename FileT, typename FieldT>
+  void fileToField(const FileT* fileData,
+                   const std::size_t fileLevelSize,
+                   const size_t* fileIndices,
+                   const std::size_t numPoints,
+                   const std::size_t numLevels,
+                         FieldT* fieldData,
+                   const std::size_t fieldStride,
+                         ThreadPool* threadPool = nullptr);
+
+  /// \brief Copies numLevels levels of field data, with the given stride between points, to file
+  ///        data, converting from FieldT to FileT. Each level of file data holds fileLevelSize
+  ///        points. Field data for point i are written to file point fileIndices[i], so that any
+  ///        subset of points, e.g. those gathered from one PE, can be copied. Indices are not
+  ///        checked, so must be distinct and less than fileLevelSize.
+  template<typename FieldT, typename FileT>
+  void fieldToFile(const FieldT* fieldData,
+                   const std::size_t fieldStride,
+                   const size_t* fileIndices,
+                   const std::size_t numPoints,
+                   const std::size_t numLevels,
+                         FileT* fileData,
+                   const std::size_t fileLevelSize,
+                         ThreadPool* threadPool = nullptr);
+}  // namespace remap
+}  // namespace monio
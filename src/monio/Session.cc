@@ -0,0 +1,59 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "Session.h"
+
+#include "oops/util/Logger.h"
+
+#include "Monio.h"
+#include "Utils.h"
+
+monio::Session::Session(const atlas::Grid& grid,
+                        const std::string& filePath,
+                        const bool isState) :
+    filePath_(filePath),
+    isState_(isState) {
+  oops::Log::debug() << "Session::Session()" << std::endl;
+  Monio::get().openSession(grid, filePath_, isState_);
+}
+
+monio::Session::~Session() {
+  oops::Log::debug() << "Session::~Session()" << std::endl;
+  Monio::get().closeSession();
+}
+
+void monio::Session::readFields(atlas::FieldSet& localFieldSet,
+                          const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                          const util::DateTime& dateTime) {
+  oops::Log::debug() << "Session::readFields()" << std::endl;
+  if (isState_ == false) {
+    Monio::get().closeFiles();
+    utils::throwException("Session::readFields()> File \"" + filePath_ +
+                          "\" has no time component...");
+  }
+  Monio::get().readSession(localFieldSet, fieldMetadataVec, dateTime, true);
+}
+
+void monio::Session::readFields(atlas::FieldSet& localFieldSet,
+                          const std::vector<consts::FieldMetadata>& fieldMetadataVec) {
+  oops::Log::debug() << "Session::readFields()" << std::endl;
+  if (isState_ == true) {
+    Monio::get().closeFiles();
+    utils::throwException("Session::readFields()> File \"" + filePath_ +
+                          "\" requires a date-time...");
+  }
+  Monio::get().readSession(localFieldSet, fieldMetadataVec, util::DateTime(), false);
+}
+
+bool monio::Session::isOpen() const {
+  return Monio::get().isSessionOpen();
+}
+
+const std::string& monio::Session::getFilePath() const {
+  return filePath_;
+}
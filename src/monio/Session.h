@@ -0,0 +1,61 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "atlas/field.h"
+#include "atlas/grid.h"
+#include "oops/util/DateTime.h"
+
+#include "Constants.h"
+
+namespace monio {
+/// \brief Holds a file open for reading, so that its existence, metadata, geometry and time axis
+///        are checked and read once for any number of reads of its fields, e.g. at each time of a
+///        window. Reads are serial, or via the I/O server PEs where started. The file is closed on
+///        destruction. One session can be open at a time. All functions are collective calls.
+class Session {
+ public:
+  /// \brief Opens a file for reading on a given grid. Files with a time component, i.e. state
+  ///        files, are read with a date-time.
+  Session(const atlas::Grid& grid,
+          const std::string& filePath,
+          const bool isState = true);
+
+  ~Session();
+
+  Session()                          = delete;  //!< Deleted default constructor
+  Session(Session&&)                 = delete;  //!< Deleted move constructor
+  Session(const Session&)            = delete;  //!< Deleted copy constructor
+  Session& operator=(Session&&)      = delete;  //!< Deleted move assignment
+  Session& operator=(const Session&) = delete;  //!< Deleted copy assignment
+
+  /// \brief Reads fields at a date-time from a file with a time component.
+  void readFields(atlas::FieldSet& localFieldSet,
+            const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+            const util::DateTime& dateTime);
+
+  /// \brief Reads fields from a file without a time component, i.e. an increment file.
+  void readFields(atlas::FieldSet& localFieldSet,
+            const std::vector<consts::FieldMetadata>& fieldMetadataVec);
+
+  /// \brief Returns true where the session's file is held open. On read owner PEs, this is whether
+  ///        the file itself is open. Files of sessions via I/O servers are held by the I/O server
+  ///        PEs, so elsewhere this is whether the session is open.
+  bool isOpen() const;
+
+  const std::string& getFilePath() const;
+
+ private:
+  const std::string filePath_;
+  const bool isState_;
+};
+}  // namespace monio
@@ -0,0 +1,118 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+#include "oops/util/Logger.h"
+
+namespace {
+/// \brief True on the workers of any pool.
+thread_local bool isWorker = false;
+
+std::size_t getThreadCount(const int numThreads) {
+  std::size_t threadCount = numThreads > 0 ? numThreads : std::thread::hardware_concurrency();
+  return std::max(std::size_t(1), threadCount);
+}
+}  // anonymous namespace
+
+monio::ThreadPool::ThreadPool(const int numThreads) {
+  startWorkers(getThreadCount(numThreads) - 1);
+}
+
+monio::ThreadPool::~ThreadPool() {
+  stopWorkers();
+}
+
+void monio::ThreadPool::setNumThreads(const int numThreads) {
+  oops::Log::debug() << "ThreadPool::setNumThreads()" << std::endl;
+  stopWorkers();
+  startWorkers(getThreadCount(numThreads) - 1);
+}
+
+std::size_t monio::ThreadPool::getNumThreads() const {
+  return workers_.size() + 1;
+}
+
+void monio::ThreadPool::run(const std::size_t numTasks,
+                            const std::function<void(const std::size_t task)>& processTask) {
+  if (workers_.size() == 0 || isWorker == true) {
+    for (std::size_t task = 0; task < numTasks; ++task) {
+      processTask(task);
+    }
+    return;
+  }
+  std::vector<std::future<void>> results;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t task = 1; task < numTasks; ++task) {
+      std::packaged_task<void()> queuedTask([&processTask, task]() { processTask(task); });
+      results.push_back(queuedTask.get_future());
+      tasks_.push_back(std::move(queuedTask));
+    }
+  }
+  taskQueued_.notify_all();
+  // Queued tasks refer to processTask, so all are complete before any error is rethrown
+  std::exception_ptr error;
+  if (numTasks > 0) {
+    try {
+      processTask(0);
+    } catch (...) {
+      error = std::current_exception();
+    }
+  }
+  for (auto& result : results) {
+    result.wait();
+  }
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+  for (auto& result : results) {
+    result.get();
+  }
+}
+
+void monio::ThreadPool::startWorkers(const std::size_t numWorkers) {
+  isStopping_ = false;
+  workers_.reserve(numWorkers);
+  for (std::size_t i = 0; i < numWorkers; ++i) {
+    workers_.emplace_back(&ThreadPool::processQueue, this);
+  }
+}
+
+void monio::ThreadPool::stopWorkers() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopping_ = true;
+  }
+  taskQueued_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+  workers_.clear();
+}
+
+void monio::ThreadPool::processQueue() {
+  isWorker = true;
+  while (true) {
+    std::packaged_task<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      taskQueued_.wait(lock, [this]() { return isStopping_ == true || tasks_.size() != 0; });
+      if (tasks_.size() == 0) {
+        return;  // Stopping, with no tasks left to run
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
@@ -0,0 +1,65 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <condition_variable>  // NOLINT(build/c++11)
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>  // NOLINT(build/c++11)
+#include <mutex>  // NOLINT(build/c++11)
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+namespace monio {
+/// \brief A persistent set of worker threads, to which the remap kernels submit blocks of work
+///        (see remap::forBlocks), so that threads are not created for each call. Owned by Monio,
+///        and sized by Monio::setRemapThreads.
+class ThreadPool {
+ public:
+  /// \brief Creates a pool of numThreads threads, including the calling thread, which runs tasks
+  ///        alongside numThreads - 1 workers. Non-positive values use the number of hardware
+  ///        threads.
+  explicit ThreadPool(const int numThreads = 1);
+
+  ~ThreadPool();
+
+  ThreadPool(ThreadPool&&)                 = delete;  //!< Deleted move constructor
+  ThreadPool(const ThreadPool&)            = delete;  //!< Deleted copy constructor
+  ThreadPool& operator=(ThreadPool&&)      = delete;  //!< Deleted move assignment
+  ThreadPool& operator=(const ThreadPool&) = delete;  //!< Deleted copy assignment
+
+  /// \brief Stops the workers, once queued tasks are complete, and starts numThreads - 1 new ones.
+  ///        Must not be called while tasks are running.
+  void setNumThreads(const int numThreads);
+
+  /// \brief Returns the number of threads that run tasks, including the calling thread.
+  std::size_t getNumThreads() const;
+
+  /// \brief Calls processTask for each task from zero to numTasks - 1, and returns once all are
+  ///        complete. Task zero runs on the calling thread, and the rest on workers. Where called
+  ///        from a worker, e.g. by a kernel within a task, all tasks run on the calling thread, so
+  ///        that workers never wait for each other. The first error raised by a task is rethrown.
+  void run(const std::size_t numTasks,
+           const std::function<void(const std::size_t task)>& processTask);
+
+ private:
+  void startWorkers(const std::size_t numWorkers);
+  void stopWorkers();
+
+  /// \brief Runs queued tasks on a worker until the pool stops.
+  void processQueue();
+
+  std::vector<std::thread> workers_;
+  std::deque<std::packaged_task<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable taskQueued_;
+  bool isStopping_ = false;
+};
+}  // namespace monio
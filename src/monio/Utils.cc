@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <array>
+#include <filesystem>
 #include <fstream>
 #include <memory>
 
@@ -23,6 +24,10 @@
 
 #include "oops/util/Logger.h"
 
+namespace {
+thread_local bool isBackground = false;
+}  // anonymous namespace
+
 namespace monio {
 namespace utils {
 std::vector<std::string> strToWords(const std::string inputStr,
@@ -82,6 +87,20 @@ bool fileExists(std::string path) {
   return f.good();
 }
 
+std::string getFileId(const std::string& path) {
+  std::error_code errorCode;
+  std::uintmax_t fileSize = std::filesystem::file_size(path, errorCode);
+  if (errorCode) {
+    return "";
+  }
+  std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(path, errorCode);
+  if (errorCode) {
+    return "";
+  }
+  return path + ":" + std::to_string(fileSize) + ":" +
+         std::to_string(writeTime.time_since_epoch().count());
+}
+
 template<typename T1, typename T2>
 std::vector<T1> extractKeys(std::map<T1, T2> const& inputMap) {
   std::vector<T1> keyVector;
@@ -124,10 +143,41 @@ bool findInVector(std::vector<T> vector, T searchTerm) {
 
 template bool findInVector<std::string>(std::vector<std::string> vector, std::string searchTerm);
 
+template<typename T>
+void broadcastVector(const eckit::mpi::Comm& mpiCommunicator,
+                     std::vector<T>& vector,
+                     const std::size_t root) {
+  std::size_t size = vector.size();
+  mpiCommunicator.broadcast(size, root);
+  vector.resize(size);
+  mpiCommunicator.broadcast(vector.data(), size, root);
+}
+
+template void broadcastVector<char>(const eckit::mpi::Comm& mpiCommunicator,
+                                    std::vector<char>& vector,
+                                    const std::size_t root);
+template void broadcastVector<size_t>(const eckit::mpi::Comm& mpiCommunicator,
+                                      std::vector<size_t>& vector,
+                                      const std::size_t root);
+template void broadcastVector<int>(const eckit::mpi::Comm& mpiCommunicator,
+                                   std::vector<int>& vector,
+                                   const std::size_t root);
+
+void setBackgroundThread(const bool isBackgroundThread) {
+  isBackground = isBackgroundThread;
+}
+
+bool isBackgroundThread() {
+  return isBackground;
+}
+
 void throwException(const std::string message) {
   oops::Log::error() << message << std::endl;
-  // Call MPI abort on the WORLD communicator.
-  eckit::mpi::comm("world").abort();
+  // Call MPI abort on the WORLD communicator. Errors on a background thread are raised, and abort,
+  // on the thread that waits for its work.
+  if (isBackground == false) {
+    eckit::mpi::comm("world").abort();
+  }
   throw std::runtime_error(message);
 }
 }  // namespace utils
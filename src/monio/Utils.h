@@ -15,6 +15,8 @@
 #include <string>
 #include <vector>
 
+#include "eckit/mpi/Comm.h"
+
 namespace monio {
 /// \brief Contains general helper functions
 namespace utils {
@@ -26,6 +28,10 @@ namespace utils {
 
   bool strToBool(std::string input);
   bool fileExists(std::string path);
+  /// \brief Returns a string identifying a file by its path, size and last modification time. Used
+  ///        to detect where a file has been accessed before and is unchanged. Returns an empty
+  ///        string where the file cannot be accessed.
+  std::string getFileId(const std::string& path);
 
   std::string exec(const std::string& cmd);
 
@@ -38,6 +44,20 @@ namespace utils {
   template<typename T>
   bool findInVector(std::vector<T> vector, T searchTerm);
 
+  /// \brief Broadcasts a vector of any size from the root PE, resizing it on all other PEs.
+  template<typename T>
+  void broadcastVector(const eckit::mpi::Comm& mpiCommunicator,
+                       std::vector<T>& vector,
+                       const std::size_t root);
+
+  /// \brief Marks the calling thread as a background thread, or not. On a background thread,
+  ///        throwException throws without aborting, and files are not closed, so that the error is
+  ///        raised, and files closed, by the thread that waits for the work (see Monio::flush).
+  void setBackgroundThread(const bool isBackgroundThread);
+
+  /// \brief Returns true where the calling thread has been marked as a background thread.
+  bool isBackgroundThread();
+
   [[noreturn]] void throwException(const std::string message);
 }  // namespace utils
 }  // namespace monio
@@ -8,8 +8,20 @@
 ******************************************************************************/
 #include "UtilsAtlas.h"
 
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
 #include <numeric>
+#include <sstream>
+#include <thread>  // NOLINT(build/c++11)
 
 #include "atlas/functionspace.h"
 #include "atlas/grid/Iterator.h"
@@ -97,8 +109,78 @@ std::vector<std::shared_ptr<monio::DataContainerBase>> convertLatLonToContainers
   return coordContainers;
 }
 
+namespace {
+  const double kPi = std::acos(-1.0);
+  const double kDegToRad = kPi / 180.0;
+
+  /// \brief Returns the position of the equiangular cubed-sphere cell containing a point, ordered
+  ///        by cube face, then row and column. Both LFRic and Atlas points are located this way,
+  ///        so the result is independent of either's ordering.
+  std::size_t getCubedSphereCell(const atlas::PointLonLat& point, const std::size_t cellsPerEdge) {
+    const double lon = point.lon() * kDegToRad;
+    const double lat = point.lat() * kDegToRad;
+    const double xyz[3] = {std::cos(lat) * std::cos(lon), std::cos(lat) * std::sin(lon),
+                           std::sin(lat)};
+    // The face is given by the axis of the largest component and its sign
+    std::size_t axis = 0;
+    for (std::size_t i = 1; i < 3; ++i) {
+      if (std::abs(xyz[i]) > std::abs(xyz[axis])) {
+        axis = i;
+      }
+    }
+    const std::size_t face = 2 * axis + (xyz[axis] < 0.0 ? 1 : 0);
+    const double alpha = std::atan(xyz[(axis + 1) % 3] / std::abs(xyz[axis]));
+    const double beta = std::atan(xyz[(axis + 2) % 3] / std::abs(xyz[axis]));
+    const double cellWidth = (kPi / 2.0) / cellsPerEdge;
+    const std::size_t maxIndex = cellsPerEdge - 1;
+    const std::size_t i = std::min(maxIndex, std::size_t((alpha + kPi / 4.0) / cellWidth));
+    const std::size_t j = std::min(maxIndex, std::size_t((beta + kPi / 4.0) / cellWidth));
+    return (face * cellsPerEdge + j) * cellsPerEdge + i;
+  }
+}  // anonymous namespace
+
+std::vector<size_t> createCubedSphereMap(const std::vector<atlas::PointLonLat>& atlasCoords,
+                                         const std::vector<atlas::PointLonLat>& lfricCoords) {
+  std::vector<size_t> lfricAtlasMap;
+  const std::size_t numPoints = atlasCoords.size();
+  const std::size_t cellsPerEdge = std::lround(std::sqrt(numPoints / 6.0));
+  if (numPoints == 0 || lfricCoords.size() != numPoints ||
+      6 * cellsPerEdge * cellsPerEdge != numPoints) {
+    return lfricAtlasMap;
+  }
+  const std::size_t kNoPoint = numPoints;
+  std::vector<size_t> cellToAtlas(numPoints, kNoPoint);
+  for (std::size_t i = 0; i < numPoints; ++i) {
+    std::size_t& atlasIndex = cellToAtlas[getCubedSphereCell(atlasCoords[i], cellsPerEdge)];
+    if (atlasIndex != kNoPoint) {
+      return lfricAtlasMap;  // More than one point per cell
+    }
+    atlasIndex = i;
+  }
+  // Paired points are checked against a small fraction of the cell width, in degrees
+  const double tolerance = 0.01 * 90.0 / cellsPerEdge;
+  lfricAtlasMap.resize(numPoints);
+  for (std::size_t i = 0; i < numPoints; ++i) {
+    const atlas::PointLonLat& lfricCoord = lfricCoords[i];
+    const std::size_t atlasIndex = cellToAtlas[getCubedSphereCell(lfricCoord, cellsPerEdge)];
+    if (atlasIndex == kNoPoint) {
+      return std::vector<size_t>();
+    }
+    const atlas::PointLonLat& atlasCoord = atlasCoords[atlasIndex];
+    double lonDiff = std::abs(lfricCoord.lon() - atlasCoord.lon());
+    lonDiff = std::min(lonDiff, std::abs(360.0 - lonDiff));
+    if (std::abs(lfricCoord.lat() - atlasCoord.lat()) > tolerance ||
+        lonDiff * std::cos(lfricCoord.lat() * kDegToRad) > tolerance) {
+      return std::vector<size_t>();
+    }
+    lfricAtlasMap[i] = atlasIndex;
+  }
+  return lfricAtlasMap;
+}
+
 std::vector<size_t> createLfricAtlasMap(const std::vector<atlas::PointLonLat>& atlasCoords,
-                                        const std::vector<atlas::PointLonLat>& lfricCoords) {
+                                        const std::vector<atlas::PointLonLat>& lfricCoords,
+                                        const int numThreads) {
   std::vector<size_t> lfricAtlasMap;
   // Essential check to ensure grid is configured to accommodate the data
   if (atlasCoords.size() != lfricCoords.size()) {
@@ -106,7 +188,26 @@ std::vector<size_t> createLfricAtlasMap(const std::vector<atlas::PointLonLat>& a
     utils::throwException("utilsatlas::createLfricAtlasMap()> "
       "Configured grid is not compatible with input file...");
   }
-  lfricAtlasMap.reserve(atlasCoords.size());
+  // Cubed-sphere meshes are mapped directly. Others fall back to a nearest-neighbour search.
+  lfricAtlasMap = createCubedSphereMap(atlasCoords, lfricCoords);
+  if (lfricAtlasMap.size() != 0) {
+    return lfricAtlasMap;
+  }
+  oops::Log::debug() << "utilsatlas::createLfricAtlasMap()> Mesh is not a recognised "
+                        "cubed-sphere. Using k-d tree..." << std::endl;
+  return createLfricAtlasMapWithKDTree(atlasCoords, lfricCoords, numThreads);
+}
+
+std::vector<size_t> createLfricAtlasMapWithKDTree(
+                                        const std::vector<atlas::PointLonLat>& atlasCoords,
+                                        const std::vector<atlas::PointLonLat>& lfricCoords,
+                                        const int numThreads) {
+  if (atlasCoords.size() != lfricCoords.size()) {
+    Monio::get().closeFiles();
+    utils::throwException("utilsatlas::createLfricAtlasMapWithKDTree()> "
+      "Configured grid is not compatible with input file...");
+  }
+  std::vector<size_t> lfricAtlasMap(lfricCoords.size());
 
   // Make a kd-tree using atlasLonLat as the point,
   // with element index i as payload
@@ -117,33 +218,170 @@ std::vector<size_t> createLfricAtlasMap(const std::vector<atlas::PointLonLat>& a
   atlas::util::IndexKDTree tree(unitSphere);
   tree.build(atlasCoords, indices);
 
-  // Partitioning vector to create atlas::Distribution for mesh generation
-  std::vector<int> partitioning(tree.size(), -1);
+  // find atlas global indices for each element of modelLonLat. The built tree is only read, so
+  // contiguous ranges of points are queried by separate threads.
+  std::size_t threadCount = numThreads > 0 ? numThreads : std::thread::hardware_concurrency();
+  threadCount = std::max(std::size_t(1), std::min(threadCount, lfricCoords.size()));
+  auto queryRange = [&](const std::size_t start, const std::size_t end) {
+    for (std::size_t i = start; i < end; ++i) {
+      lfricAtlasMap[i] = tree.closestPoint(lfricCoords[i]).payload();
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(threadCount - 1);
+  std::size_t rangeSize = (lfricCoords.size() + threadCount - 1) / threadCount;
+  for (std::size_t t = 1; t < threadCount; ++t) {
+    std::size_t start = std::min(t * rangeSize, lfricCoords.size());
+    std::size_t end = std::min(start + rangeSize, lfricCoords.size());
+    threads.emplace_back(queryRange, start, end);
+  }
+  queryRange(0, std::min(rangeSize, lfricCoords.size()));  // First range on the calling thread
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return lfricAtlasMap;
+}
+
+namespace {
+  const char kCacheMagic[8] = {'M', 'O', 'N', 'I', 'O', 'M', 'A', 'P'};
+  const std::uint64_t kCacheVersion = 1;
+}  // anonymous namespace
 
-  // find atlas global indices for each element of modelLonLat
-  for (const auto& lfricCoord : lfricCoords) {
-    auto idx = tree.closestPoint(lfricCoord).payload();
-    lfricAtlasMap.push_back(idx);
+std::uint64_t hashCoords(const std::vector<atlas::PointLonLat>& coords) {
+  // 64-bit FNV-1a over the bytes of each coordinate
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (const auto& coord : coords) {
+    const double lonLat[2] = {coord.lon(), coord.lat()};
+    unsigned char bytes[sizeof(lonLat)];
+    std::memcpy(bytes, lonLat, sizeof(lonLat));
+    for (const unsigned char byte : bytes) {
+      hash ^= byte;
+      hash *= 1099511628211ULL;
+    }
+  }
+  return hash;
+}
+
+std::string getLfricAtlasMapCachePath(const std::string& cacheDir,
+                                      const std::string& gridName,
+                                      const std::size_t numPoints,
+                                      const std::uint64_t coordsHash) {
+  std::stringstream cachePath;
+  cachePath << cacheDir << "/lfric_atlas_map_" << gridName << "_" << numPoints << "_"
+            << std::hex << std::setw(16) << std::setfill('0') << coordsHash << ".bin";
+  return cachePath.str();
+}
+
+std::vector<size_t> readLfricAtlasMap(const std::string& cachePath,
+                                      const std::string& gridName,
+                                      const std::size_t numPoints,
+                                      const std::uint64_t coordsHash) {
+  std::vector<size_t> lfricAtlasMap;
+  std::ifstream cacheFile(cachePath, std::ios::binary);
+  if (cacheFile.good() == false) {
+    return lfricAtlasMap;
+  }
+  char magic[sizeof(kCacheMagic)];
+  std::uint64_t header[4];  // Version, grid name length, number of points and coordinates hash
+  cacheFile.read(magic, sizeof(magic));
+  cacheFile.read(reinterpret_cast<char*>(header), sizeof(header));
+  if (cacheFile.good() == false ||
+      std::memcmp(magic, kCacheMagic, sizeof(kCacheMagic)) != 0 ||
+      header[0] != kCacheVersion || header[1] != gridName.size() ||
+      header[2] != numPoints || header[3] != coordsHash) {
+    oops::Log::info() << "utilsatlas::readLfricAtlasMap()> Cache file \"" << cachePath <<
+                         "\" does not match. Ignoring..." << std::endl;
+    return lfricAtlasMap;
+  }
+  std::string cacheGridName(gridName.size(), '\0');
+  cacheFile.read(&cacheGridName[0], cacheGridName.size());
+  std::vector<std::uint64_t> cacheMap(numPoints);
+  cacheFile.read(reinterpret_cast<char*>(cacheMap.data()), numPoints * sizeof(std::uint64_t));
+  if (cacheFile.good() == false || cacheGridName != gridName ||
+      cacheFile.peek() != std::ifstream::traits_type::eof() ||
+      std::any_of(cacheMap.begin(), cacheMap.end(),
+                  [numPoints](const std::uint64_t index) { return index >= numPoints; })) {
+    oops::Log::info() << "utilsatlas::readLfricAtlasMap()> Cache file \"" << cachePath <<
+                         "\" is not valid. Ignoring..." << std::endl;
+    return lfricAtlasMap;
   }
+  lfricAtlasMap.assign(cacheMap.begin(), cacheMap.end());
   return lfricAtlasMap;
 }
 
-atlas::Field getGlobalField(const atlas::Field& field) {
-  if (field.metadata().get<bool>("global") == false) {
-    atlas::array::DataType atlasType = field.datatype();
-    atlas::idx_t numLevels = field.shape(consts::eVertical);
-    atlas::util::Config atlasOptions = atlas::option::name(field.name()) |
-                                       atlas::option::levels(numLevels) |
-                                       atlas::option::datatype(atlasType) |
-                                       atlas::option::global(0);
-    if (atlasType != atlasType.KIND_REAL64 &&
-        atlasType != atlasType.KIND_REAL32 &&
-        atlasType != atlasType.KIND_INT32) {
-        Monio::get().closeFiles();
-        utils::throwException("utilsatlas::getGlobalFieldSet())> Data type not coded for...");
+bool writeLfricAtlasMap(const std::string& cachePath,
+                        const std::string& gridName,
+                        const std::uint64_t coordsHash,
+                        const std::vector<size_t>& lfricAtlasMap) {
+  // Owner PEs, and other executables sharing the cache directory, may write the same map at the
+  // same time. Each writes its own uniquely-named temporary file, created by mkstemp.
+  std::string tempPath = cachePath + ".tmpXXXXXX";
+  int tempFd = mkstemp(&tempPath[0]);
+  if (tempFd == -1) {
+    return false;
+  }
+  fchmod(tempFd, 0644);  // mkstemp creates files readable by their owner only
+  close(tempFd);
+  {
+    std::ofstream cacheFile(tempPath, std::ios::binary | std::ios::trunc);
+    const std::uint64_t header[4] = {kCacheVersion, gridName.size(), lfricAtlasMap.size(),
+                                     coordsHash};
+    std::vector<std::uint64_t> cacheMap(lfricAtlasMap.begin(), lfricAtlasMap.end());
+    cacheFile.write(kCacheMagic, sizeof(kCacheMagic));
+    cacheFile.write(reinterpret_cast<const char*>(header), sizeof(header));
+    cacheFile.write(gridName.data(), gridName.size());
+    cacheFile.write(reinterpret_cast<const char*>(cacheMap.data()),
+                    cacheMap.size() * sizeof(std::uint64_t));
+    if (cacheFile.good() == false) {
+      std::remove(tempPath.c_str());
+      return false;
+    }
+  }
+  if (std::rename(tempPath.c_str(), cachePath.c_str()) != 0) {
+    std::remove(tempPath.c_str());
+    return false;
+  }
+  return true;
+}
+
+std::vector<size_t> getLocalFileIndices(const atlas::Field& field,
+                                        const std::vector<size_t>& lfricAtlasMap) {
+  atlas::Field globalIndexField = field.functionspace().global_index();
+  auto globalIndexView = atlas::array::make_view<atlas::gidx_t, 1>(globalIndexField);
+  atlas::idx_t size = getHorizontalSize(field);
+  std::vector<size_t> localFileIndices(size);
+  for (atlas::idx_t i = 0; i < size; ++i) {
+    std::size_t atlasIndex = globalIndexView(i) - 1;  // Atlas global indices start at 1
+    if (atlasIndex >= lfricAtlasMap.size()) {
+      Monio::get().closeFiles();
+      utils::throwException("utilsatlas::getLocalFileIndices()> "
+                            "Global index exceeds size of LFRic-Atlas map...");
     }
+    localFileIndices[i] = lfricAtlasMap[atlasIndex];
+  }
+  return localFileIndices;
+}
+
+atlas::Field createGlobalField(const atlas::Field& field, const int mpiRankOwner) {
+  atlas::array::DataType atlasType = field.datatype();
+  atlas::idx_t numLevels = field.shape(consts::eVertical);
+  atlas::util::Config atlasOptions = atlas::option::name(field.name()) |
+                                     atlas::option::levels(numLevels) |
+                                     atlas::option::datatype(atlasType) |
+                                     atlas::option::global(mpiRankOwner);
+  if (atlasType != atlasType.KIND_REAL64 &&
+      atlasType != atlasType.KIND_REAL32 &&
+      atlasType != atlasType.KIND_INT32) {
+      Monio::get().closeFiles();
+      utils::throwException("utilsatlas::createGlobalField())> Data type not coded for...");
+  }
+  return field.functionspace().createField(atlasOptions);
+}
+
+atlas::Field getGlobalField(const atlas::Field& field, const int mpiRankOwner) {
+  if (field.metadata().get<bool>("global") == false) {
     const auto& functionSpace = field.functionspace();
-    atlas::Field globalField = functionSpace.createField(atlasOptions);
+    atlas::Field globalField = createGlobalField(field, mpiRankOwner);
     field.haloExchange();
     functionSpace.gather(field, globalField);
     return globalField;
@@ -152,6 +390,179 @@ atlas::Field getGlobalField(const atlas::Field& field) {
   }
 }
 
+namespace {
+  std::vector<atlas::idx_t> getOwnedPoints(const atlas::FunctionSpace& functionSpace) {
+    atlas::Field ghostField = functionSpace.ghost();
+    auto ghostView = atlas::array::make_view<int, 1>(ghostField);
+    std::vector<atlas::idx_t> ownedPoints;
+    for (atlas::idx_t i = 0; i < ghostField.shape(0); ++i) {
+      if (ghostView(i) == 0) {
+        ownedPoints.push_back(i);
+      }
+    }
+    return ownedPoints;
+  }
+
+  /// \brief Returns the index of the end of a group of fields, starting at groupStart, whose global
+  ///        data fit within the limit of an MPI count. sumLevels includes any additional levels.
+  std::size_t getGroupEnd(const std::vector<atlas::Field>& fields,
+                          const std::vector<std::size_t>& fieldIndices,
+                          const std::size_t groupStart,
+                          const std::size_t globalSize,
+                          const atlas::idx_t localSize,
+                          std::size_t& sumLevels) {
+    const std::size_t maxValues = std::numeric_limits<int>::max();
+    std::size_t groupEnd = groupStart;
+    while (groupEnd < fieldIndices.size()) {
+      const atlas::Field& field = fields[fieldIndices[groupEnd]];
+      if (field.shape(0) != localSize) {
+        Monio::get().closeFiles();
+        utils::throwException("utilsatlas::getGroupEnd()> Fields do not share a function space...");
+      }
+      std::size_t numLevels = field.shape(consts::eVertical);
+      if (groupEnd > groupStart && (sumLevels + numLevels) * globalSize > maxValues) {
+        break;
+      }
+      sumLevels += numLevels;
+      ++groupEnd;
+    }
+    if (sumLevels * globalSize > maxValues) {
+      Monio::get().closeFiles();
+      utils::throwException("utilsatlas::getGroupEnd()> Field is too large to communicate...");
+    }
+    return groupEnd;
+  }
+
+  template<typename T>
+  void packField(std::vector<double>& buffer,
+                 const atlas::Field& field,
+                 const std::vector<atlas::idx_t>& ownedPoints) {
+    auto fieldView = atlas::array::make_view<T, 2>(field);
+    for (const atlas::idx_t point : ownedPoints) {
+      for (atlas::idx_t j = 0; j < field.shape(consts::eVertical); ++j) {
+        buffer.push_back(static_cast<double>(fieldView(point, j)));
+      }
+    }
+  }
+
+  template<typename T>
+  void unpackField(const double* buffer,
+                   atlas::Field& globalField,
+                   const double* globalIndices,
+                   const std::size_t numPoints) {
+    auto fieldView = atlas::array::make_view<T, 2>(globalField);
+    const atlas::idx_t numLevels = globalField.shape(consts::eVertical);
+    for (std::size_t i = 0; i < numPoints; ++i) {
+      atlas::idx_t point = static_cast<atlas::idx_t>(globalIndices[i]) - 1;  // Start at 1
+      for (atlas::idx_t j = 0; j < numLevels; ++j) {
+        fieldView(point, j) = static_cast<T>(*buffer++);
+      }
+    }
+  }
+}  // anonymous namespace
+
+void getOwnedPointIndices(const atlas::FunctionSpace& functionSpace,
+                                std::vector<size_t>& localPoints,
+                                std::vector<size_t>& globalIndices) {
+  auto globalIndexView = atlas::array::make_view<atlas::gidx_t, 1>(functionSpace.global_index());
+  std::vector<atlas::idx_t> ownedPoints = getOwnedPoints(functionSpace);
+  localPoints.resize(ownedPoints.size());
+  globalIndices.resize(ownedPoints.size());
+  for (std::size_t i = 0; i < ownedPoints.size(); ++i) {
+    localPoints[i] = ownedPoints[i];
+    globalIndices[i] = globalIndexView(ownedPoints[i]) - 1;  // Atlas global indices start at 1
+  }
+}
+
+std::vector<atlas::Field> getGlobalFields(const std::vector<atlas::Field>& fields,
+                                          const eckit::mpi::Comm& mpiCommunicator,
+                                          const int mpiRankOwner) {
+  std::vector<atlas::Field> globalFields(fields.size());
+  std::vector<std::size_t> localFieldIndices;
+  for (std::size_t i = 0; i < fields.size(); ++i) {
+    if (fields[i].metadata().get<bool>("global") == false) {
+      localFieldIndices.push_back(i);
+    } else {
+      globalFields[i] = fields[i];
+    }
+  }
+  if (localFieldIndices.size() == 0) {
+    return globalFields;
+  }
+  const auto& functionSpace = fields[localFieldIndices.front()].functionspace();
+  const std::size_t globalSize =
+                        atlas::functionspace::NodeColumns(functionSpace).mesh().grid().size();
+  // Locally-owned points and their global indices. Global indices are packed with the data, as
+  // doubles, so that a single gather is required. Halo exchanges are not required, as only
+  // locally-owned points are gathered.
+  auto globalIndexView = atlas::array::make_view<atlas::gidx_t, 1>(functionSpace.global_index());
+  std::vector<atlas::idx_t> ownedPoints = getOwnedPoints(functionSpace);
+  const atlas::idx_t localSize = functionSpace.ghost().shape(0);
+  // Fields are divided into groups that fit within the limit of an MPI count on the owner PE
+  std::size_t groupStart = 0;
+  while (groupStart < localFieldIndices.size()) {
+    std::size_t sumLevels = 1;  // Includes global indices
+    std::size_t groupEnd = getGroupEnd(fields, localFieldIndices, groupStart, globalSize,
+                                       localSize, sumLevels);
+    // Pack global indices and data
+    std::vector<double> sendBuffer;
+    sendBuffer.reserve(ownedPoints.size() * sumLevels);
+    for (const atlas::idx_t point : ownedPoints) {
+      sendBuffer.push_back(static_cast<double>(globalIndexView(point)));
+    }
+    for (std::size_t i = groupStart; i < groupEnd; ++i) {
+      const atlas::Field& field = fields[localFieldIndices[i]];
+      atlas::array::DataType atlasType = field.datatype();
+      if (atlasType == atlasType.KIND_REAL64) {
+        packField<double>(sendBuffer, field, ownedPoints);
+      } else if (atlasType == atlasType.KIND_REAL32) {
+        packField<float>(sendBuffer, field, ownedPoints);
+      } else if (atlasType == atlasType.KIND_INT32) {
+        packField<int>(sendBuffer, field, ownedPoints);
+      } else {
+        Monio::get().closeFiles();
+        utils::throwException("utilsatlas::getGlobalFields()> Data type not coded for...");
+      }
+      globalFields[localFieldIndices[i]] = createGlobalField(field, mpiRankOwner);
+    }
+    // Gather
+    std::vector<int> recvCounts;
+    mpiCommunicator.gather(static_cast<int>(sendBuffer.size()), recvCounts, mpiRankOwner);
+    std::vector<int> displs(recvCounts.size(), 0);
+    std::vector<double> recvBuffer;
+    if (mpiCommunicator.rank() == std::size_t(mpiRankOwner)) {
+      for (std::size_t i = 1; i < recvCounts.size(); ++i) {
+        displs[i] = displs[i - 1] + recvCounts[i - 1];
+      }
+      recvBuffer.resize(displs.back() + recvCounts.back());
+    }
+    mpiCommunicator.gatherv(sendBuffer.data(), sendBuffer.size(), recvBuffer.data(),
+                            recvCounts.data(), displs.data(), mpiRankOwner);
+    // Unpack
+    if (mpiCommunicator.rank() == std::size_t(mpiRankOwner)) {
+      for (std::size_t pe = 0; pe < recvCounts.size(); ++pe) {
+        const std::size_t numPoints = recvCounts[pe] / sumLevels;
+        const double* globalIndices = recvBuffer.data() + displs[pe];
+        const double* buffer = globalIndices + numPoints;
+        for (std::size_t i = groupStart; i < groupEnd; ++i) {
+          atlas::Field& globalField = globalFields[localFieldIndices[i]];
+          atlas::array::DataType atlasType = globalField.datatype();
+          if (atlasType == atlasType.KIND_REAL64) {
+            unpackField<double>(buffer, globalField, globalIndices, numPoints);
+          } else if (atlasType == atlasType.KIND_REAL32) {
+            unpackField<float>(buffer, globalField, globalIndices, numPoints);
+          } else {
+            unpackField<int>(buffer, globalField, globalIndices, numPoints);
+          }
+          buffer += numPoints * globalField.shape(consts::eVertical);
+        }
+      }
+    }
+    groupStart = groupEnd;
+  }
+  return globalFields;
+}
+
 atlas::FieldSet getGlobalFieldSet(const atlas::FieldSet& fieldSet) {
   if (fieldSet.size() != 0) {
     atlas::FieldSet globalFieldSet;
@@ -205,6 +616,20 @@ int atlasTypeToMonioEnum(atlas::array::DataType atlasType) {
   }
 }
 
+int getFileDataType(const atlas::Field& field, const consts::FieldMetadata& fieldMetadata) {
+  int fieldDataType = atlasTypeToMonioEnum(field.datatype());
+  if (fieldMetadata.fileDataType == -1 || fieldMetadata.fileDataType == fieldDataType) {
+    return fieldDataType;
+  }
+  if (fieldMetadata.fileDataType != consts::eFloat &&
+      fieldMetadata.fileDataType != consts::eDouble) {
+    Monio::get().closeFiles();
+    utils::throwException("utilsatlas::getFileDataType()> Field \"" + field.name() +
+                          "\" cannot be written with the requested data type...");
+  }
+  return fieldMetadata.fileDataType;
+}
+
 bool compareFieldSets(const atlas::FieldSet& aSet, const atlas::FieldSet& bSet) {
   for (auto& a : aSet) {
     if (compareFields(a, bSet[a.name()]) == false) {
@@ -8,6 +8,7 @@
 ******************************************************************************/
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -36,18 +37,87 @@ namespace utilsatlas {
                                         const std::vector<atlas::PointLonLat>& atlasCoords,
                                         const std::vector<std::string>& coordNames);
 
+  /// \brief Returns the position in Atlas order of each LFRic point. Cubed-sphere meshes are
+  ///        mapped directly. Others use a k-d tree search, with the given number of threads.
   std::vector<size_t> createLfricAtlasMap(const std::vector<atlas::PointLonLat>& atlasCoords,
-                                          const std::vector<atlas::PointLonLat>& lfricCoords);
+                                          const std::vector<atlas::PointLonLat>& lfricCoords,
+                                          const int numThreads = 0);
+
+  /// \brief Returns the position in Atlas order of each LFRic point, for grids of one point per
+  ///        cell of an equiangular cubed sphere. Points are paired via the cell containing them,
+  ///        without a search. Returns an empty map where the points do not fit this layout, or
+  ///        paired points do not coincide.
+  std::vector<size_t> createCubedSphereMap(const std::vector<atlas::PointLonLat>& atlasCoords,
+                                           const std::vector<atlas::PointLonLat>& lfricCoords);
+
+  /// \brief Returns the position in Atlas order of each LFRic point by k-d tree search. Queries
+  ///        are divided between threads, which default to the number of hardware threads where
+  ///        numThreads is not positive. The result does not depend on the number of threads.
+  std::vector<size_t> createLfricAtlasMapWithKDTree(
+                                          const std::vector<atlas::PointLonLat>& atlasCoords,
+                                          const std::vector<atlas::PointLonLat>& lfricCoords,
+                                          const int numThreads = 0);
+
+  /// \brief Returns a hash of the given coordinates, for identifying an LFRic mesh.
+  std::uint64_t hashCoords(const std::vector<atlas::PointLonLat>& coords);
+
+  /// \brief Returns the path of a cached LFRic-Atlas map in a given directory.
+  std::string getLfricAtlasMapCachePath(const std::string& cacheDir,
+                                        const std::string& gridName,
+                                        const std::size_t numPoints,
+                                        const std::uint64_t coordsHash);
+
+  /// \brief Returns a map read from a cache file. An empty map is returned where the file does not
+  ///        exist, or where its contents do not match the given grid name, size and hash.
+  std::vector<size_t> readLfricAtlasMap(const std::string& cachePath,
+                                        const std::string& gridName,
+                                        const std::size_t numPoints,
+                                        const std::uint64_t coordsHash);
+
+  /// \brief Writes a map to a cache file. The file is written under a temporary name and renamed,
+  ///        so that a partially written file is never read. Returns false on failure.
+  bool writeLfricAtlasMap(const std::string& cachePath,
+                          const std::string& gridName,
+                          const std::uint64_t coordsHash,
+                          const std::vector<size_t>& lfricAtlasMap);
+
+  /// \brief Returns the position in file order of each locally-owned point of a decomposed field.
+  std::vector<size_t> getLocalFileIndices(const atlas::Field& field,
+                                          const std::vector<size_t>& lfricAtlasMap);
+
+  /// \brief Returns the positions and (zero-based) global indices of the locally-owned points of a
+  ///        function space, for creation of an OwnerPlan.
+  void getOwnedPointIndices(const atlas::FunctionSpace& functionSpace,
+                                  std::vector<size_t>& localPoints,
+                                  std::vector<size_t>& globalIndices);
 
   atlas::FieldSet getGlobalFieldSet(const atlas::FieldSet& fieldSet);
 
-  atlas::Field getGlobalField(const atlas::Field& field);
+  /// \brief Returns an empty global field on the given owner PE, matching a decomposed field.
+  atlas::Field createGlobalField(const atlas::Field& field,
+                                 const int mpiRankOwner = consts::kMPIRankOwner);
+
+  /// \brief Returns a field gathered to the given owner PE.
+  atlas::Field getGlobalField(const atlas::Field& field,
+                              const int mpiRankOwner = consts::kMPIRankOwner);
+
+  /// \brief Returns fields gathered to the given owner PE. The locally-owned points of all fields
+  ///        are packed into a single buffer per PE and gathered together, rather than with one
+  ///        collective per field. All fields must share a function space.
+  std::vector<atlas::Field> getGlobalFields(const std::vector<atlas::Field>& fields,
+                                            const eckit::mpi::Comm& mpiCommunicator,
+                                            const int mpiRankOwner = consts::kMPIRankOwner);
 
   atlas::idx_t getHorizontalSize(const atlas::Field& field);  // Just 2D size. Any field.
   atlas::idx_t getGlobalDataSize(const atlas::Field& field);  // Full 3D size of global field.
 
   int atlasTypeToMonioEnum(atlas::array::DataType atlasType);
 
+  /// \brief Returns the data type written to file for a field, from its metadata, or the field's
+  ///        own type where none is given. Fields are only written as integers where they are
+  ///        integer fields.
+  int getFileDataType(const atlas::Field& field, const consts::FieldMetadata& fieldMetadata);
+
   bool compareFieldSets(const atlas::FieldSet& aSet, const atlas::FieldSet& bSet);
   bool compareFields(const atlas::Field& a, const atlas::Field& b);
 }  // namespace utilsatlas
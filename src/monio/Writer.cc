@@ -11,6 +11,7 @@
 #include <netcdf>
 #include <map>
 #include <stdexcept>
+#include <utility>
 
 #include "Constants.h"
 #include "DataContainerDouble.h"
@@ -20,6 +21,17 @@
 
 #include "oops/util/Logger.h"
 
+namespace {
+void checkSlabSize(const std::string& varName,
+                   const size_t dataSize,
+                   const size_t slabSize) {
+  if (dataSize != slabSize) {
+    monio::utils::throwException("Writer::writeDatumLevels()> Data for variable \"" +
+                                 varName + "\" do not match the size of the slab...");
+  }
+}
+}  // anonymous namespace
+
 monio::Writer::Writer(const eckit::mpi::Comm& mpiCommunicator,
                       const int mpiRankOwner,
                       const std::string& filePath) :
@@ -36,12 +48,18 @@ monio::Writer::Writer(const eckit::mpi::Comm& mpiCommunicator,
   oops::Log::debug() << "Writer::Writer()" << std::endl;
 }
 
-void monio::Writer::openFile(const std::string& filePath) {
+void monio::Writer::setMpiRankOwner(const int mpiRankOwner) {
+  oops::Log::debug() << "Writer::setMpiRankOwner()" << std::endl;
+  mpiRankOwner_ = mpiRankOwner;
+}
+
+void monio::Writer::openFile(const std::string& filePath,
+                             const netCDF::NcFile::FileMode fileMode) {
   oops::Log::debug() << "Writer::openFile() \"" << filePath << "\"..." << std::endl;
   if (mpiCommunicator_.rank() == mpiRankOwner_) {
     if (filePath.size() != 0) {
       try {
-        file_ = std::make_unique<File>(filePath, netCDF::NcFile::replace);
+        file_ = std::make_unique<File>(filePath, fileMode);
       } catch (netCDF::exceptions::NcException& exception) {
         closeFile();
         utils::throwException("Writer::openFile()> An exception occurred while creating File...");
@@ -109,6 +127,62 @@ void monio::Writer::writeData(const FileData& fileData) {
   }
 }
 
+void monio::Writer::writeDatumLevels(const std::shared_ptr<DataContainerBase>& dataContainer,
+                                     const size_t levelStart,
+                                     const size_t numLevels) {
+  oops::Log::debug() << "Writer::writeDatumLevels()" << std::endl;
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    std::string varName = dataContainer->getName();
+    std::vector<size_t> startVec;
+    std::vector<size_t> countVec;
+    size_t slabSize = 1;
+    std::vector<std::pair<std::string, size_t>> dimensions = getFile().getVarDimensions(varName);
+    for (auto const& dimPair : dimensions) {
+      if (dimPair.first == consts::kHorizontalName) {
+        startVec.push_back(0);
+        countVec.push_back(dimPair.second);
+        slabSize *= dimPair.second;
+      } else {
+        if (levelStart + numLevels > dimPair.second) {
+          closeFile();
+          utils::throwException("Writer::writeDatumLevels()> Levels for variable \"" + varName +
+                                "\" exceed size of dimension \"" + dimPair.first + "\"...");
+        }
+        startVec.push_back(levelStart);
+        countVec.push_back(numLevels);
+        slabSize *= numLevels;
+      }
+    }
+    switch (dataContainer->getType()) {
+      case consts::eDataTypes::eDouble: {
+        std::shared_ptr<DataContainerDouble> dataContainerDouble =
+            std::static_pointer_cast<DataContainerDouble>(dataContainer);
+        checkSlabSize(varName, dataContainerDouble->getData().size(), slabSize);
+        getFile().writeFieldDatum(varName, startVec, countVec, dataContainerDouble->getData());
+        break;
+      }
+      case consts::eDataTypes::eFloat: {
+        std::shared_ptr<DataContainerFloat> dataContainerFloat =
+            std::static_pointer_cast<DataContainerFloat>(dataContainer);
+        checkSlabSize(varName, dataContainerFloat->getData().size(), slabSize);
+        getFile().writeFieldDatum(varName, startVec, countVec, dataContainerFloat->getData());
+        break;
+      }
+      case consts::eDataTypes::eInt: {
+        std::shared_ptr<DataContainerInt> dataContainerInt =
+            std::static_pointer_cast<DataContainerInt>(dataContainer);
+        checkSlabSize(varName, dataContainerInt->getData().size(), slabSize);
+        getFile().writeFieldDatum(varName, startVec, countVec, dataContainerInt->getData());
+        break;
+      }
+      default: {
+        closeFile();
+        utils::throwException("Writer::writeDatumLevels()> Data type not coded for...");
+      }
+    }
+  }
+}
+
 monio::File& monio::Writer::getFile() {
   oops::Log::debug() << "Writer::getFile()" << std::endl;
   if (isOpen() == false) {
@@ -38,18 +38,28 @@ class Writer {
   Writer& operator=(Writer&&)      = delete;  //!< Deleted move assign
   Writer& operator=(const Writer&) = delete;  //!< Deleted copy assign
 
-  void openFile(const std::string& filePath);
+  /// \brief Sets the PE rank that handles I/O. Where there are multiple owner PEs, each owner PE
+  ///        sets its own rank.
+  void setMpiRankOwner(const int mpiRankOwner);
+
+  /// \brief Opens a file for writing. By default, any existing file is replaced.
+  void openFile(const std::string& filePath,
+                const netCDF::NcFile::FileMode fileMode = netCDF::NcFile::replace);
   void closeFile();
   bool isOpen();
 
   void writeMetadata(const Metadata& metadata);
   void writeData(const FileData& fileData);
+  /// \brief Writes a slab of vertical levels of a single variable, already defined in the file.
+  void writeDatumLevels(const std::shared_ptr<DataContainerBase>& dataContainer,
+                        const size_t levelStart,
+                        const size_t numLevels);
 
  private:
   File& getFile();
 
   const eckit::mpi::Comm& mpiCommunicator_;
-  const std::size_t mpiRankOwner_;
+  std::size_t mpiRankOwner_;
 
   std::unique_ptr<File> file_;
 };
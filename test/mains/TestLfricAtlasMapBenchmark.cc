@@ -0,0 +1,19 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "../monio/LfricAtlasMapBenchmark.h"
+#include "oops/runs/Run.h"
+
+/// \brief This test targets utilsatlas::createLfricAtlasMapWithKDTree. It times the creation of a
+///        map between shuffled coordinates and those of a cubed-sphere grid, with each configured
+///        number of threads. A test pass is achieved if every map matches the single-threaded map.
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  monio::test::LfricAtlasMapBenchmark tests;
+  return run.execute(tests);
+}
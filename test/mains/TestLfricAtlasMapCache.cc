@@ -0,0 +1,20 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "../monio/LfricAtlasMapCache.h"
+#include "oops/runs/Run.h"
+
+/// \brief This test targets utilsatlas::readLfricAtlasMap and utilsatlas::writeLfricAtlasMap. A
+///        map between shuffled coordinates and those of a cubed-sphere grid is written to the
+///        cache and read back. A test pass is achieved if the map read matches the map created,
+///        and cache files of another mesh, or truncated files, are rejected.
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  monio::test::LfricAtlasMapCache tests;
+  return run.execute(tests);
+}
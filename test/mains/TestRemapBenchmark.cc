@@ -0,0 +1,20 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "../monio/RemapBenchmark.h"
+#include "oops/runs/Run.h"
+
+/// \brief This test targets the kernels of monio::remap. It times the remap of a field of each data
+///        type between file and Atlas order, by the loops previously used and by the kernels, with
+///        each configured number of threads. A test pass is achieved if all kernels match the
+///        loops.
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  monio::test::RemapBenchmark tests;
+  return run.execute(tests);
+}
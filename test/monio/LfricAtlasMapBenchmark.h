@@ -0,0 +1,99 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#define ECKIT_TESTING_SELF_REGISTER_CASES 0
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "atlas/grid/CubedSphereGrid.h"
+#include "atlas/util/Point.h"
+#include "eckit/log/Timer.h"
+#include "eckit/testing/Test.h"
+
+#include "monio/UtilsAtlas.h"
+
+#include "oops/../test/TestEnvironment.h"
+#include "oops/runs/Test.h"
+#include "oops/util/Logger.h"
+
+namespace monio {
+namespace test {
+/// Times creation of the LFRic-Atlas map by k-d tree search with each configured number of threads,
+/// and checks each map matches the map created with a single thread. Also checks the map created
+/// analytically for the cubed sphere, and by default, matches that of the search.
+void benchmarkFunction() {
+  oops::Log::info() << "monio::test::benchmarkFunction()" << std::endl;
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  const atlas::CubedSphereGrid grid(paramConfig.getString("gridName"));
+  const std::vector<int> threadCounts = paramConfig.getIntVector("threadCounts");
+
+  // LFRic coordinates are represented by the Atlas coordinates in a reproducible, shuffled order
+  std::vector<atlas::PointLonLat> atlasCoords = utilsatlas::getAtlasCoords(grid);
+  std::vector<atlas::PointLonLat> lfricCoords = atlasCoords;
+  std::shuffle(lfricCoords.begin(), lfricCoords.end(), std::mt19937(0));
+
+  std::vector<size_t> serialMap;
+  {
+    eckit::Timer timer("monio::test::benchmarkFunction()> 1 thread", oops::Log::info());
+    serialMap = utilsatlas::createLfricAtlasMapWithKDTree(atlasCoords, lfricCoords, 1);
+  }
+  for (const int threadCount : threadCounts) {
+    std::vector<size_t> lfricAtlasMap;
+    {
+      eckit::Timer timer("monio::test::benchmarkFunction()> " + std::to_string(threadCount) +
+                         " threads", oops::Log::info());
+      lfricAtlasMap = utilsatlas::createLfricAtlasMapWithKDTree(atlasCoords, lfricCoords,
+                                                                threadCount);
+    }
+    if (lfricAtlasMap != serialMap) {
+      throw eckit::Stop("Map created with " + std::to_string(threadCount) +
+                        " threads does not match map created with 1 thread");
+    }
+  }
+
+  std::vector<size_t> cubedSphereMap;
+  {
+    eckit::Timer timer("monio::test::benchmarkFunction()> cubed sphere", oops::Log::info());
+    cubedSphereMap = utilsatlas::createCubedSphereMap(atlasCoords, lfricCoords);
+  }
+  if (cubedSphereMap.size() == 0) {
+    throw eckit::Stop("Grid " + grid.name() + " is not mapped as a cubed sphere");
+  }
+  if (cubedSphereMap != serialMap) {
+    throw eckit::Stop("Map created for the cubed sphere does not match map created by k-d tree");
+  }
+  if (utilsatlas::createLfricAtlasMap(atlasCoords, lfricCoords) != serialMap) {
+    throw eckit::Stop("Default map does not match map created by k-d tree");
+  }
+}
+
+class LfricAtlasMapBenchmark : public oops::Test{
+ public:
+  LfricAtlasMapBenchmark() {}
+  virtual ~LfricAtlasMapBenchmark() {}
+ private:
+  std::string testid() const override {
+    return "monio::test::LfricAtlasMapBenchmark";
+  }
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    std::function<void(std::string&, int&, int)> testFn =
+        [](std::string &, int&, int) { benchmarkFunction(); };
+    ts.push_back(eckit::testing::Test("monio/test_lfric_atlas_map_benchmark", testFn));
+  }
+  void clear() const override {}
+};
+}  // namespace test
+}  // namespace monio
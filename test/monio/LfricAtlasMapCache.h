@@ -0,0 +1,111 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#define ECKIT_TESTING_SELF_REGISTER_CASES 0
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "atlas/grid/CubedSphereGrid.h"
+#include "atlas/util/Point.h"
+#include "eckit/testing/Test.h"
+
+#include "monio/UtilsAtlas.h"
+
+#include "oops/../test/TestEnvironment.h"
+#include "oops/runs/Test.h"
+#include "oops/util/Logger.h"
+
+namespace monio {
+namespace test {
+/// Writes a map to the cache, and checks the map read back from it, with no previous map to reuse,
+/// matches the map created by search. Also checks that a cache file of a different mesh, or one
+/// that is truncated, is rejected.
+void cacheFunction() {
+  oops::Log::info() << "monio::test::cacheFunction()" << std::endl;
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  const atlas::CubedSphereGrid grid(paramConfig.getString("gridName"));
+  const std::string cacheDir = paramConfig.getString("lfricAtlasMapCacheDir");
+
+  // LFRic coordinates are represented by the Atlas coordinates in a reproducible, shuffled order
+  std::vector<atlas::PointLonLat> atlasCoords = utilsatlas::getAtlasCoords(grid);
+  std::vector<atlas::PointLonLat> lfricCoords = atlasCoords;
+  std::shuffle(lfricCoords.begin(), lfricCoords.end(), std::mt19937(0));
+  std::vector<size_t> lfricAtlasMap = utilsatlas::createLfricAtlasMap(atlasCoords, lfricCoords);
+
+  const std::uint64_t coordsHash = utilsatlas::hashCoords(lfricCoords);
+  const std::string cachePath = utilsatlas::getLfricAtlasMapCachePath(cacheDir, grid.name(),
+                                                              lfricCoords.size(), coordsHash);
+  std::remove(cachePath.c_str());  // Left by a previous run
+  if (utilsatlas::readLfricAtlasMap(cachePath, grid.name(), lfricCoords.size(),
+                                    coordsHash).size() != 0) {
+    throw eckit::Stop("Map read from missing cache file \"" + cachePath + "\"");
+  }
+  if (utilsatlas::writeLfricAtlasMap(cachePath, grid.name(), coordsHash, lfricAtlasMap) == false) {
+    throw eckit::Stop("Unable to write cache file \"" + cachePath + "\"");
+  }
+  if (utilsatlas::readLfricAtlasMap(cachePath, grid.name(), lfricCoords.size(),
+                                    coordsHash) != lfricAtlasMap) {
+    throw eckit::Stop("Map read from cache does not match map created by search");
+  }
+
+  // Cache files of another mesh are rejected
+  if (utilsatlas::readLfricAtlasMap(cachePath, grid.name(), lfricCoords.size(),
+                                    coordsHash + 1).size() != 0) {
+    throw eckit::Stop("Map read from cache file with mismatched hash");
+  }
+  if (utilsatlas::readLfricAtlasMap(cachePath, grid.name(), lfricCoords.size() - 1,
+                                    coordsHash).size() != 0) {
+    throw eckit::Stop("Map read from cache file with mismatched number of points");
+  }
+
+  // Truncated cache files, e.g. of an interrupted write by another executable, are rejected
+  std::vector<char> cacheBytes;
+  {
+    std::ifstream cacheFile(cachePath, std::ios::binary);
+    cacheBytes.assign(std::istreambuf_iterator<char>(cacheFile), std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream cacheFile(cachePath, std::ios::binary | std::ios::trunc);
+    cacheFile.write(cacheBytes.data(), cacheBytes.size() - sizeof(std::uint64_t));
+  }
+  if (utilsatlas::readLfricAtlasMap(cachePath, grid.name(), lfricCoords.size(),
+                                    coordsHash).size() != 0) {
+    throw eckit::Stop("Map read from truncated cache file");
+  }
+  std::remove(cachePath.c_str());
+}
+
+class LfricAtlasMapCache : public oops::Test{
+ public:
+  LfricAtlasMapCache() {}
+  virtual ~LfricAtlasMapCache() {}
+ private:
+  std::string testid() const override {
+    return "monio::test::LfricAtlasMapCache";
+  }
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    std::function<void(std::string&, int&, int)> testFn =
+        [](std::string &, int&, int) { cacheFunction(); };
+    ts.push_back(eckit::testing::Test("monio/test_lfric_atlas_map_cache", testFn));
+  }
+  void clear() const override {}
+};
+}  // namespace test
+}  // namespace monio
@@ -0,0 +1,236 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#define ECKIT_TESTING_SELF_REGISTER_CASES 0
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "atlas/grid/CubedSphereGrid.h"
+#include "eckit/log/Timer.h"
+#include "eckit/testing/Test.h"
+
+#include "monio/Remap.h"
+#include "monio/ThreadPool.h"
+
+#include "oops/../test/TestEnvironment.h"
+#include "oops/runs/Test.h"
+#include "oops/util/Logger.h"
+
+namespace monio {
+namespace test {
+/// Times the remap of one field of a given type between file and Atlas order, both by the loops
+/// previously used by AtlasReader::populateField and AtlasWriter::populateDataVec, by the tiled
+/// kernels with each configured number of threads, and by the read kernel packing subsets of
+/// points into double-precision data, as for each PE in serial reads, and checks all give the same
+/// data.
+template<typename T>
+void benchmarkType(const std::string& typeName,
+                   const std::vector<size_t>& lfricToAtlasMap,
+                   const std::size_t numLevels,
+                   const std::vector<int>& threadCounts) {
+  oops::Log::info() << "monio::test::benchmarkType()> " << typeName << std::endl;
+  const std::size_t numPoints = lfricToAtlasMap.size();
+  std::vector<T> fileData(numPoints * numLevels);
+  std::iota(fileData.begin(), fileData.end(), T(0));
+
+  std::vector<T> loopFieldData(numPoints * numLevels);
+  {
+    eckit::Timer timer("monio::test::benchmarkType()> " + typeName + " read loops",
+                       oops::Log::info());
+    for (std::size_t j = 0; j < numLevels; ++j) {
+      for (std::size_t i = 0; i < numPoints; ++i) {
+        loopFieldData[(i * numLevels) + j] = fileData[lfricToAtlasMap[i] + (j * numPoints)];
+      }
+    }
+  }
+  std::vector<T> kernelFieldData(numPoints * numLevels);
+  {
+    eckit::Timer timer("monio::test::benchmarkType()> " + typeName + " read kernel",
+                       oops::Log::info());
+    remap::fileToField<T, T>(fileData.data(), numPoints, lfricToAtlasMap.data(), numPoints,
+                             numLevels, kernelFieldData.data(), numLevels);
+  }
+  if (kernelFieldData != loopFieldData) {
+    throw eckit::Stop("Read kernel does not match read loops for " + typeName);
+  }
+  // Packs contiguous subsets of points, as OwnerPlan::packFileData does for each PE
+  std::vector<T> packData(numPoints * numLevels);
+  {
+    eckit::Timer timer("monio::test::benchmarkType()> " + typeName + " pack kernel",
+                       oops::Log::info());
+    const std::size_t numSubsets = 6;
+    for (std::size_t subset = 0; subset < numSubsets; ++subset) {
+      const std::size_t start = (subset * numPoints) / numSubsets;
+      const std::size_t end = ((subset + 1) * numPoints) / numSubsets;
+      remap::fileToField<T, T>(fileData.data(), numPoints, lfricToAtlasMap.data() + start,
+                               end - start, numLevels, packData.data() + (start * numLevels),
+                               numLevels);
+    }
+  }
+  if (packData != loopFieldData) {
+    throw eckit::Stop("Pack kernel does not match read loops for " + typeName);
+  }
+
+  std::vector<T> loopFileData(numPoints * numLevels);
+  {
+    eckit::Timer timer("monio::test::benchmarkType()> " + typeName + " write loops",
+                       oops::Log::info());
+    for (std::size_t i = 0; i < numPoints; ++i) {
+      for (std::size_t j = 0; j < numLevels; ++j) {
+        loopFileData[lfricToAtlasMap[i] + (j * numPoints)] = loopFieldData[(i * numLevels) + j];
+      }
+    }
+  }
+  std::vector<T> kernelFileData(numPoints * numLevels);
+  {
+    eckit::Timer timer("monio::test::benchmarkType()> " + typeName + " write kernel",
+                       oops::Log::info());
+    remap::fieldToFile(kernelFieldData.data(), numLevels, lfricToAtlasMap.data(), numPoints,
+                       numLevels, kernelFileData.data(), numPoints);
+  }
+  if (kernelFileData != loopFileData || kernelFileData != fileData) {
+    throw eckit::Stop("Write kernel does not match write loops for " + typeName);
+  }
+  // Unpacks contiguous subsets of points, as OwnerPlan::unpackFileData does for each PE
+  std::vector<T> unpackData(numPoints * numLevels);
+  {
+    eckit::Timer timer("monio::test::benchmarkType()> " + typeName + " unpack kernel",
+                       oops::Log::info());
+    const std::size_t numSubsets = 6;
+    for (std::size_t subset = 0; subset < numSubsets; ++subset) {
+      const std::size_t start = (subset * numPoints) / numSubsets;
+      const std::size_t end = ((subset + 1) * numPoints) / numSubsets;
+      remap::fieldToFile(packData.data() + (start * numLevels), numLevels,
+                         lfricToAtlasMap.data() + start, end - start, numLevels,
+                         unpackData.data(), numPoints);
+    }
+  }
+  if (unpackData != loopFileData) {
+    throw eckit::Stop("Unpack kernel does not match write loops for " + typeName);
+  }
+
+  for (const int threadCount : threadCounts) {
+    const std::string threadsName = typeName + " " + std::to_string(threadCount) + " threads";
+    ThreadPool threadPool(threadCount);  // Threads are started before the kernels are timed
+    std::vector<T> threadFieldData(numPoints * numLevels);
+    {
+      eckit::Timer timer("monio::test::benchmarkType()> " + threadsName + " read kernel",
+                         oops::Log::info());
+      remap::fileToField<T, T>(fileData.data(), numPoints, lfricToAtlasMap.data(), numPoints,
+                               numLevels, threadFieldData.data(), numLevels, &threadPool);
+    }
+    std::vector<T> threadFileData(numPoints * numLevels);
+    {
+      eckit::Timer timer("monio::test::benchmarkType()> " + threadsName + " write kernel",
+                         oops::Log::info());
+      remap::fieldToFile(threadFieldData.data(), numLevels, lfricToAtlasMap.data(), numPoints,
+                         numLevels, threadFileData.data(), numPoints, &threadPool);
+    }
+    if (threadFieldData != loopFieldData || threadFileData != loopFileData) {
+      throw eckit::Stop("Kernels with " + threadsName + " do not match loops");
+    }
+  }
+}
+
+/// Times the remap of one field from file data of type FileT to field data of type FieldT, both by
+/// a remap followed by a separate conversion, and by the fused kernel, and checks both give the
+/// same data. Where FileT is floating-point, the field data are also written back to file data.
+template<typename FileT, typename FieldT>
+void benchmarkConversion(const std::string& typesName,
+                         const std::vector<size_t>& lfricToAtlasMap,
+                         const std::size_t numLevels) {
+  oops::Log::info() << "monio::test::benchmarkConversion()> " << typesName << std::endl;
+  const std::size_t numPoints = lfricToAtlasMap.size();
+  std::vector<FileT> fileData(numPoints * numLevels);
+  std::iota(fileData.begin(), fileData.end(), FileT(0));
+
+  std::vector<FieldT> copyFieldData(numPoints * numLevels);
+  {
+    eckit::Timer timer("monio::test::benchmarkConversion()> " + typesName +
+                       " remap and convert", oops::Log::info());
+    std::vector<FileT> remappedData(numPoints * numLevels);
+    remap::fileToField<FileT, FileT>(fileData.data(), numPoints, lfricToAtlasMap.data(),
+                                     numPoints, numLevels, remappedData.data(), numLevels);
+    std::copy(remappedData.begin(), remappedData.end(), copyFieldData.begin());
+  }
+  std::vector<FieldT> fusedFieldData(numPoints * numLevels);
+  {
+    eckit::Timer timer("monio::test::benchmarkConversion()> " + typesName +
+                       " fused read kernel", oops::Log::info());
+    remap::fileToField<FileT, FieldT>(fileData.data(), numPoints, lfricToAtlasMap.data(),
+                                      numPoints, numLevels, fusedFieldData.data(), numLevels);
+  }
+  if (fusedFieldData != copyFieldData) {
+    throw eckit::Stop("Fused read kernel does not match remap and conversion for " + typesName);
+  }
+
+  if constexpr (std::is_floating_point<FileT>::value) {
+    std::vector<FileT> fusedFileData(numPoints * numLevels);
+    {
+      eckit::Timer timer("monio::test::benchmarkConversion()> " + typesName +
+                         " fused write kernel", oops::Log::info());
+      remap::fieldToFile(fusedFieldData.data(), numLevels, lfricToAtlasMap.data(), numPoints,
+                         numLevels, fusedFileData.data(), numPoints);
+    }
+    if (fusedFileData != fileData) {
+      throw eckit::Stop("Fused write kernel does not return file data for " + typesName);
+    }
+  }
+}
+
+/// Benchmarks the remap of each data type, and conversions between them, for a shuffled map of the
+/// size of a cubed-sphere grid.
+void benchmarkFunction() {
+  oops::Log::info() << "monio::test::benchmarkFunction()" << std::endl;
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  const atlas::CubedSphereGrid grid(paramConfig.getString("gridName"));
+  const std::size_t numLevels = paramConfig.getInt("numberOfLevels");
+  const std::vector<int> threadCounts = paramConfig.getIntVector("threadCounts");
+
+  std::vector<size_t> lfricToAtlasMap(grid.size());
+  std::iota(lfricToAtlasMap.begin(), lfricToAtlasMap.end(), 0);
+  std::shuffle(lfricToAtlasMap.begin(), lfricToAtlasMap.end(), std::mt19937(0));
+  if (remap::isPermutation(lfricToAtlasMap) == false) {
+    throw eckit::Stop("Shuffled map is not a permutation");
+  }
+
+  benchmarkType<double>("double", lfricToAtlasMap, numLevels, threadCounts);
+  benchmarkType<float>("float", lfricToAtlasMap, numLevels, threadCounts);
+  benchmarkType<int>("int", lfricToAtlasMap, numLevels, threadCounts);
+  benchmarkConversion<float, double>("float to double", lfricToAtlasMap, numLevels);
+  benchmarkConversion<int, double>("int to double", lfricToAtlasMap, numLevels);
+  benchmarkConversion<int, float>("int to float", lfricToAtlasMap, numLevels);
+}
+
+class RemapBenchmark : public oops::Test{
+ public:
+  RemapBenchmark() {}
+  virtual ~RemapBenchmark() {}
+ private:
+  std::string testid() const override {
+    return "monio::test::RemapBenchmark";
+  }
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    std::function<void(std::string&, int&, int)> testFn =
+        [](std::string &, int&, int) { benchmarkFunction(); };
+    ts.push_back(eckit::testing::Test("monio/test_remap_benchmark", testFn));
+  }
+  void clear() const override {}
+};
+}  // namespace test
+}  // namespace monio
@@ -11,6 +11,7 @@
 #define ECKIT_TESTING_SELF_REGISTER_CASES 0
 
 #include <algorithm>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <string>
@@ -21,10 +22,13 @@
 #include "atlas/grid/CubedSphereGrid.h"
 #include "atlas/mesh/Mesh.h"
 #include "atlas/meshgenerator/MeshGenerator.h"
+#include "eckit/config/YAMLConfiguration.h"
+#include "eckit/filesystem/PathName.h"
 #include "eckit/testing/Test.h"
 
 #include "monio/Constants.h"
 #include "monio/Monio.h"
+#include "monio/Session.h"
 #include "monio/Utils.h"
 #include "monio/UtilsAtlas.h"
 
@@ -76,38 +80,209 @@ void compare(atlas::FieldSet& firstFieldSet, atlas::FieldSet& secondFieldSet) {
   }
 }
 
+/// Rounds the data of fields written to file with single precision, so that they match those read
+/// back from file.
+void roundToFileDataType(atlas::FieldSet& fieldSet,
+                         const std::vector<consts::FieldMetadata>& fieldMetadataVec) {
+  oops::Log::info() << "monio::test::roundToFileDataType()" << std::endl;
+  for (const auto& fieldMetadata : fieldMetadataVec) {
+    if (fieldMetadata.fileDataType == consts::eFloat) {
+      auto fieldView = atlas::array::make_view<double, 2>(fieldSet[fieldMetadata.jediName]);
+      for (atlas::idx_t i = 0; i < fieldView.shape(consts::eHorizontal); ++i) {
+        for (atlas::idx_t j = 0; j < fieldView.shape(consts::eVertical); ++j) {
+          fieldView(i, j) = static_cast<float>(fieldView(i, j));
+        }
+      }
+    }
+  }
+}
+
 /// Reads
 void readOutput(atlas::FieldSet& fieldSet,
                 const std::vector<consts::FieldMetadata>& fieldMetadataVec,
-                const std::string& filePath) {
+                const std::string& filePath,
+                const int readMode) {
   oops::Log::info() << "monio::test::readOutput()" << std::endl;
   oops::Log::info() << "filePath> " << filePath << std::endl;
 
   // Since Atlas Fields do not contain a time dimension, the output file adopts the same format as
   // an increment file. For this reason it is read as such.
-  Monio::get().readIncrements(fieldSet, fieldMetadataVec, filePath);
+  Monio::get().readIncrements(fieldSet, fieldMetadataVec, filePath, readMode);
 }
 
 /// Writes FieldSet to file.
 void write(const atlas::FieldSet& fieldSet,
            const std::vector<consts::FieldMetadata>& fieldMetadataVec,
-           const std::string& filePath) {
+           const std::string& filePath,
+           const int writeMode) {
   oops::Log::info() << "monio::test::write()" << std::endl;
   oops::Log::info() << "filePath> " << filePath << std::endl;
 
-  Monio::get().writeState(fieldSet, fieldMetadataVec, filePath);
+  Monio::get().writeState(fieldSet, fieldMetadataVec, filePath, true, writeMode);
 }
 
 /// Reads data from file and populates the FieldSet
 void readInput(atlas::FieldSet& fieldSet,
                const std::vector<consts::FieldMetadata>& fieldMetadataVec,
                const util::DateTime& dateTime,
-               const std::string& filePath) {
+               const std::string& filePath,
+               const int readMode) {
   oops::Log::info() << "monio::test::readInput()" << std::endl;
   oops::Log::info() << "filePath> " << filePath << std::endl;
   oops::Log::info() << "dateTime> " << dateTime << std::endl;
 
-  Monio::get().readState(fieldSet, fieldMetadataVec, filePath, dateTime);
+  Monio::get().readState(fieldSet, fieldMetadataVec, filePath, dateTime, readMode);
+}
+
+/// Creates a field set on the function space of another, for the given fields
+atlas::FieldSet createFieldSet(const atlas::FieldSet& fieldSet,
+                               std::vector<consts::FieldMetadata>& fieldMetadataVec) {
+  return createFieldSet(atlas::functionspace::CubedSphereNodeColumns(fieldSet[0].functionspace()),
+                        fieldMetadataVec);
+}
+
+/// Reads data from file at each date-time, and a subset of the fields at the first, via a single
+/// session. Checks that the file stays open between reads, then compares each field set with one
+/// read separately by readState.
+void testSession(const atlas::FieldSet& fieldSet,
+                 std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                 const std::vector<util::DateTime>& dateTimes,
+                 const std::string& gridName,
+                 const std::string& filePath) {
+  oops::Log::info() << "monio::test::testSession()" << std::endl;
+  oops::Log::info() << "filePath> " << filePath << std::endl;
+  std::vector<consts::FieldMetadata> subsetMetadataVec = {fieldMetadataVec.back()};
+  std::vector<atlas::FieldSet> sessionFieldSets;
+  atlas::FieldSet subsetFieldSet = createFieldSet(fieldSet, subsetMetadataVec);
+  {
+    Session session(atlas::Grid(gridName), filePath);
+    for (const auto& dateTime : dateTimes) {
+      sessionFieldSets.push_back(createFieldSet(fieldSet, fieldMetadataVec));
+      session.readFields(sessionFieldSets.back(), fieldMetadataVec, dateTime);
+      if (session.isOpen() == false) {
+        utils::throwException("Session file closed between reads...");
+      }
+    }
+    session.readFields(subsetFieldSet, subsetMetadataVec, dateTimes.front());
+  }
+  // Reads of the session's file by readState are independent of it once it is closed
+  for (std::size_t i = 0; i < dateTimes.size(); ++i) {
+    atlas::FieldSet stateFieldSet = createFieldSet(fieldSet, fieldMetadataVec);
+    readInput(stateFieldSet, fieldMetadataVec, dateTimes[i], filePath, consts::eSerialRead);
+    compare(sessionFieldSets[i], stateFieldSet);
+    if (i == 0) {
+      compare(subsetFieldSet, stateFieldSet);
+    }
+  }
+}
+
+/// Reads a window of distinct date-times from file with single reads, in time order and in reverse,
+/// and compares the field set of each date-time with one read separately at that time. Either way,
+/// one date-time is read at a non-zero offset from the first time step of the window.
+void testWindow(const atlas::FieldSet& fieldSet,
+                std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                const std::vector<util::DateTime>& dateTimes,
+                const std::string& filePath) {
+  oops::Log::info() << "monio::test::testWindow()" << std::endl;
+  oops::Log::info() << "filePath> " << filePath << std::endl;
+  if (dateTimes.size() < 2) {
+    utils::throwException("A window requires at least two date-times...");
+  }
+  std::vector<atlas::FieldSet> stateFieldSets;
+  for (const auto& dateTime : dateTimes) {
+    stateFieldSets.push_back(createFieldSet(fieldSet, fieldMetadataVec));
+    readInput(stateFieldSets.back(), fieldMetadataVec, dateTime, filePath, consts::eSerialRead);
+  }
+  // Otherwise, a window read returning the first time step for every date-time would pass
+  if (utilsatlas::compareFieldSets(stateFieldSets[0], stateFieldSets[1]) == true) {
+    utils::throwException("Data of distinct date-times match...");
+  }
+  for (const bool isReversed : {false, true}) {
+    std::vector<util::DateTime> windowDateTimes(dateTimes);
+    if (isReversed == true) {
+      std::reverse(windowDateTimes.begin(), windowDateTimes.end());
+    }
+    std::vector<atlas::FieldSet> windowFieldSets;
+    for (std::size_t i = 0; i < windowDateTimes.size(); ++i) {
+      windowFieldSets.push_back(createFieldSet(fieldSet, fieldMetadataVec));
+    }
+    Monio::get().readStates(windowFieldSets, fieldMetadataVec, filePath, windowDateTimes);
+    for (std::size_t i = 0; i < windowFieldSets.size(); ++i) {
+      std::size_t stateIndex = isReversed == true ? windowFieldSets.size() - 1 - i : i;
+      compare(windowFieldSets[i], stateFieldSets[stateIndex]);
+    }
+  }
+}
+
+/// Where read and write owner PEs are disjoint, reads the input whilst an asynchronous write
+/// continues on the write owner PEs, then writes it to a second file, which waits for the first
+/// write there. Checks the data read, and both written files, match the original read.
+void testSplitOwners(atlas::FieldSet& fieldSet,
+                     std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                     const util::DateTime& dateTime,
+                     const std::string& inputFilePath,
+                     const std::string& outputFilePath,
+                     const int writeMode) {
+  oops::Log::info() << "monio::test::testSplitOwners()" << std::endl;
+  atlas::FieldSet readFieldSet = createFieldSet(fieldSet, fieldMetadataVec);
+  readInput(readFieldSet, fieldMetadataVec, dateTime, inputFilePath, consts::eSerialRead);
+  roundToFileDataType(readFieldSet, fieldMetadataVec);
+  compare(readFieldSet, fieldSet);
+  const std::string secondFilePath =
+                  outputFilePath.substr(0, outputFilePath.rfind(".nc")) + "_second.nc";
+  write(readFieldSet, fieldMetadataVec, secondFilePath, writeMode);
+  for (const auto& filePath : {outputFilePath, secondFilePath}) {
+    atlas::FieldSet outputFieldSet = createFieldSet(fieldSet, fieldMetadataVec);
+    readOutput(outputFieldSet, fieldMetadataVec, filePath, consts::eSerialRead);
+    compare(outputFieldSet, fieldSet);
+  }
+}
+
+/// Reads the input, and the output written with node-aware exchange, without it. Checks both
+/// match the data exchanged with it, so that the node-aware scatter and gather are each compared
+/// with direct exchange between the owner PE and every other PE.
+void testNodeAware(atlas::FieldSet& fieldSet,
+                   std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                   const util::DateTime& dateTime,
+                   const std::string& inputFilePath,
+                   const std::string& outputFilePath) {
+  oops::Log::info() << "monio::test::testNodeAware()" << std::endl;
+  Monio::get().setNodeAwareExchange(false);
+  atlas::FieldSet inputFieldSet = createFieldSet(fieldSet, fieldMetadataVec);
+  readInput(inputFieldSet, fieldMetadataVec, dateTime, inputFilePath, consts::eSerialRead);
+  roundToFileDataType(inputFieldSet, fieldMetadataVec);
+  compare(inputFieldSet, fieldSet);
+  atlas::FieldSet outputFieldSet = createFieldSet(fieldSet, fieldMetadataVec);
+  readOutput(outputFieldSet, fieldMetadataVec, outputFilePath, consts::eSerialRead);
+  compare(outputFieldSet, fieldSet);
+  Monio::get().setNodeAwareExchange(true);
+}
+
+/// Prefetches a file that is not read next, which the read of the output discards, then prefetches
+/// the output, which waits for any asynchronous write of it, and reads it. Checks both reads match
+/// the data written.
+void testPrefetch(atlas::FieldSet& fieldSet,
+                  std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                  const std::string& inputFilePath,
+                  const std::string& outputFilePath,
+                  const int readMode) {
+  oops::Log::info() << "monio::test::testPrefetch()" << std::endl;
+  for (const auto& prefetchFilePath : {inputFilePath, outputFilePath}) {
+    Monio::get().prefetchFile(prefetchFilePath);
+    atlas::FieldSet outputFieldSet = createFieldSet(fieldSet, fieldMetadataVec);
+    readOutput(outputFieldSet, fieldMetadataVec, outputFilePath, readMode);
+    compare(outputFieldSet, fieldSet);
+  }
+}
+
+/// Returns the date-times of a list in the configuration
+std::vector<util::DateTime> getDateTimes(const eckit::LocalConfiguration& paramConfig,
+                                         const std::string& key) {
+  std::vector<util::DateTime> dateTimes;
+  for (const auto& dateTimeStr : paramConfig.getStringVector(key)) {
+    dateTimes.push_back(util::DateTime(dateTimeStr));
+  }
+  return dateTimes;
 }
 
 /// Sets up the objects required to mimic an operational call to Monio::Read via readInput
@@ -116,21 +291,49 @@ void initParams(atlas::FieldSet& firstFieldSet,
                 std::vector<consts::FieldMetadata>& fieldMetadataVec,
                 util::DateTime& dateTime,
                 std::string& inputFilePath,
-                std::string& outputFilePath) {
+                std::string& outputFilePath,
+                int& readMode,
+                int& writeMode,
+                bool& prefetchOutput) {
   oops::Log::info() << "monio::test::init()" << std::endl;
   // FieldSet
   const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
   const std::string gridName(paramConfig.getString("gridName"));
   const std::string partitionerType(paramConfig.getString("partitionerType"));
   const std::string meshType(paramConfig.getString("meshType"));
+  if (paramConfig.has("mpiRankOwners")) {
+    Monio::get().setMpiRankOwners(paramConfig.getIntVector("mpiRankOwners"));
+  }
+  if (paramConfig.has("mpiRankReadOwners")) {
+    Monio::get().setMpiRankOwners(paramConfig.getIntVector("mpiRankReadOwners"),
+                                  paramConfig.getIntVector("mpiRankWriteOwners"));
+  }
+  if (paramConfig.has("lfricAtlasMapCacheDir")) {
+    Monio::get().setLfricAtlasMapCacheDir(paramConfig.getString("lfricAtlasMapCacheDir"));
+  }
+  if (paramConfig.has("nodeAwareExchange")) {
+    Monio::get().setNodeAwareExchange(paramConfig.getBool("nodeAwareExchange"));
+  }
+  if (paramConfig.has("remapThreads")) {
+    Monio::get().setRemapThreads(paramConfig.getInt("remapThreads"));
+  }
+  if (paramConfig.has("memoryBudget")) {
+    Monio::get().setMemoryBudget(static_cast<std::size_t>(paramConfig.getLong("memoryBudget")));
+  }
 
   // Initialise Atlas objects to produce FieldSet
   atlas::CubedSphereGrid grid(gridName);
   atlas::Mesh mesh(createMesh(grid, partitionerType, meshType));
   atlas::functionspace::CubedSphereNodeColumns functionSpace(createFunctionSpace(mesh));
 
-  // fieldMetadata
-  const eckit::LocalConfiguration fieldMetadata = paramConfig.getSubConfiguration("fieldMetadata");
+  // fieldMetadata, shared by the test's configurations
+  const eckit::YAMLConfiguration fieldsConfig(
+                                  eckit::PathName(paramConfig.getString("fieldMetadataFile")));
+  const eckit::LocalConfiguration fieldMetadata(fieldsConfig, "fieldMetadata");
+  // Optional data types written to file of each field, e.g. float
+  const eckit::LocalConfiguration fileDataTypes = paramConfig.has("fileDataTypes") ?
+                          paramConfig.getSubConfiguration("fileDataTypes") :
+                          eckit::LocalConfiguration();
   for (const auto& key : fieldMetadata.keys()) {
     std::vector<std::string> stringVec = utils::strToWords(fieldMetadata.getString(key), ',');
 
@@ -144,6 +347,15 @@ void initParams(atlas::FieldSet& firstFieldSet,
     fieldMetadata.numberOfLevels =
                     std::stoi(utils::strNoWhiteSpace(stringVec[consts::eNumberOfLevels]));
     fieldMetadata.noFirstLevel = utils::strToBool(stringVec[consts::eNoFirstLevel]);
+    if (fileDataTypes.has(key)) {
+      const std::string typeName = fileDataTypes.getString(key);
+      const auto it = std::find(std::begin(consts::kDataTypeNames),
+                                std::end(consts::kDataTypeNames), typeName);
+      if (it == std::end(consts::kDataTypeNames)) {
+        utils::throwException("Data type \"" + typeName + "\" not recognised...");
+      }
+      fieldMetadata.fileDataType = std::distance(std::begin(consts::kDataTypeNames), it);
+    }
 
     fieldMetadataVec.push_back(fieldMetadata);
   }
@@ -153,22 +365,64 @@ void initParams(atlas::FieldSet& firstFieldSet,
   dateTime = util::DateTime(paramConfig.getString("dateTime"));
   inputFilePath = paramConfig.getString("inputFilePath");
   outputFilePath = paramConfig.getString("outputFilePath");
+  const std::string readModeName(paramConfig.getString("readMode", "serial"));
+  readMode = utils::findPosInVector(consts::kReadModeNames, readModeName);
+  if (readMode == -1) {
+    utils::throwException("Read mode \"" + readModeName + "\" not recognised...");
+  }
+  const std::string writeModeName(paramConfig.getString("writeMode", "serial"));
+  writeMode = utils::findPosInVector(consts::kWriteModeNames, writeModeName);
+  if (writeMode == -1) {
+    utils::throwException("Write mode \"" + writeModeName + "\" not recognised...");
+  }
+  prefetchOutput = paramConfig.getBool("prefetchOutput", false);
 }
 
 void main() {
+  // I/O server PEs handle the requests of the others until they have finished
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  const bool hasIoServer = paramConfig.has("ioServerRanks");
+  if (hasIoServer == true && Monio::startIoServer(paramConfig.getInt("ioServerRanks")) == false) {
+    return;
+  }
   atlas::FieldSet firstFieldSet;
   atlas::FieldSet secondFieldSet;
   std::vector<consts::FieldMetadata> fieldMetadataVec;
   util::DateTime dateTime;
   std::string inputFilePath;
   std::string outputFilePath;
+  int readMode;
+  int writeMode;
+  bool prefetchOutput;
 
-  initParams(firstFieldSet, secondFieldSet, fieldMetadataVec,
-             dateTime, inputFilePath, outputFilePath);
-  readInput(firstFieldSet, fieldMetadataVec, dateTime, inputFilePath);
-  write(firstFieldSet, fieldMetadataVec, outputFilePath);
-  readOutput(secondFieldSet, fieldMetadataVec, outputFilePath);
+  initParams(firstFieldSet, secondFieldSet, fieldMetadataVec, dateTime, inputFilePath,
+             outputFilePath, readMode, writeMode, prefetchOutput);
+  readInput(firstFieldSet, fieldMetadataVec, dateTime, inputFilePath, readMode);
+  if (paramConfig.has("sessionDateTimes")) {
+    testSession(firstFieldSet, fieldMetadataVec, getDateTimes(paramConfig, "sessionDateTimes"),
+                paramConfig.getString("gridName"), inputFilePath);
+  }
+  if (paramConfig.has("windowDateTimes")) {
+    testWindow(firstFieldSet, fieldMetadataVec, getDateTimes(paramConfig, "windowDateTimes"),
+               inputFilePath);
+  }
+  roundToFileDataType(firstFieldSet, fieldMetadataVec);
+  write(firstFieldSet, fieldMetadataVec, outputFilePath, writeMode);
+  if (paramConfig.has("mpiRankWriteOwners")) {
+    testSplitOwners(firstFieldSet, fieldMetadataVec, dateTime, inputFilePath, outputFilePath,
+                    writeMode);
+  }
+  if (paramConfig.getBool("nodeAwareExchange", false) == true) {
+    testNodeAware(firstFieldSet, fieldMetadataVec, dateTime, inputFilePath, outputFilePath);
+  }
+  if (prefetchOutput == true) {
+    testPrefetch(firstFieldSet, fieldMetadataVec, inputFilePath, outputFilePath, readMode);
+  }
+  readOutput(secondFieldSet, fieldMetadataVec, outputFilePath, readMode);
   compare(firstFieldSet, secondFieldSet);
+  if (hasIoServer == true) {
+    Monio::get().stopIoServer();
+  }
 }
 
 class StateFull : public oops::Test{